@@ -0,0 +1,83 @@
+# asset_cache.py
+
+# runs the conversion of convert_textures.py and convert_fonts.py: the source images are converted in parallel on every core,
+# and only the ones that changed since the last run
+# "res/manifest.json" keeps a sha1 of every source image, of the converter that made its outputs (its own code and settings)
+# and of each output file, a source is converted again when any of them changed or an output is missing
+# outputs of sources that were deleted are deleted too, and files whose contents didn't change are never rewritten
+
+import hashlib
+import json
+import os
+from concurrent.futures import ProcessPoolExecutor
+
+manifest_path = "res/manifest.json"
+
+def sha1(data):
+	return hashlib.sha1(data).hexdigest()
+
+def file_sha1(path):
+	if not os.path.isfile(path):
+		return None
+	file = open(path, "rb")
+	digest = sha1(file.read())
+	file.close()
+	return digest
+
+# the converter's own code and the settings it was given, every output made by another version gets converted again
+def converter_sha1(script, settings):
+	file = open(script, "rb")
+	digest = sha1(file.read() + repr(settings).encode("utf-8"))
+	file.close()
+	return digest
+
+# returns True when the file had to be written
+def write_if_changed(path, data):
+	if file_sha1(path) == sha1(data):
+		return False
+	if not os.path.exists(os.path.dirname(path)):
+		os.makedirs(os.path.dirname(path))
+	file = open(path, "wb")
+	file.write(data)
+	file.close()
+	return True
+
+def load_manifest():
+	if not os.path.isfile(manifest_path):
+		return {}
+	file = open(manifest_path, "r")
+	manifest = json.load(file)
+	file.close()
+	return manifest
+
+def save_manifest(manifest):
+	write_if_changed(manifest_path, (json.dumps(manifest, indent = "\t", sort_keys = True) + "\n").encode("utf-8"))
+
+def up_to_date(entry, source_sha1, converter):
+	if entry is None or entry["source"] != source_sha1 or entry["converter"] != converter:
+		return False
+	return all(file_sha1(path) == digest for path, digest in entry["outputs"].items())
+
+# convert(source) returns [(output path, bytes)], it runs in worker processes, so it has to be a top level function of the script
+# sources are the paths of the images, all of them below source_folder (the converter forgets the ones there that are gone)
+def convert_sources(sources, source_folder, convert, converter):
+	manifest = load_manifest()
+	for source in [s for s in manifest if s.startswith(source_folder + "/") and s not in sources]:
+		for path in manifest[source]["outputs"]:
+			if os.path.isfile(path):
+				os.remove(path)
+		del manifest[source]
+	hashes = {source: file_sha1(source) for source in sources}
+	todo = [source for source in sources if not up_to_date(manifest.get(source), hashes[source], converter)]
+	if todo:
+		with ProcessPoolExecutor() as pool:
+			for source, outputs in zip(todo, pool.map(convert, todo)):
+				old = manifest.get(source, {"outputs": {}})["outputs"]
+				for path in old:
+					if path not in dict(outputs) and os.path.isfile(path):
+						os.remove(path)
+				for path, data in outputs:
+					write_if_changed(path, data)
+				manifest[source] = {"source": hashes[source], "converter": converter, "outputs": {path: sha1(data) for path, data in outputs}}
+	save_manifest(manifest)
+	print("converted %d of %d in %s" % (len(todo), len(sources), source_folder))
@@ -0,0 +1,105 @@
+# asset_pack.py
+
+# packs every converted asset in "res/folder_name" into one archive "res/folder_name/assets.pak", so the game opens a single file at startup
+# convert_textures.py and convert_fonts.py both call write_pack() after converting, the loose files stay next to it as a fallback
+# the archive is only written when its contents changed
+#
+# layout (every field uses the byte order of the archive):
+#   0   4 bytes  magic "PAK2"
+#   4   1 byte   byte order of the archive, "B" (calculator) or "L", texture pixels are stored in this order too
+#   5   1 byte   reserved
+#   6   2 bytes  number of entries
+#   8   16 bytes per entry, sorted by name hash: name hash, offset, size, type ("T" texture, "F" font), name length (1 byte), name offset (2 bytes)
+#   the names follow the index without a terminating 0, the loader compares them so a name that only shares the hash isn't found
+#   the entry data follows, every entry starts on a multiple of 16 bytes (the file contents are unchanged apart from the byte order)
+# names are the file names, fonts are prefixed with "fnt/" ("pipe0", "fnt/5x6") and hashed with 32-bit FNV-1a
+
+import os
+import struct
+import asset_cache
+
+pack_name = "assets.pak"
+pack_alignment = 16
+
+def fnv1a(name):
+	h = 0x811C9DC5
+	for c in name.encode("ascii"):
+		h = ((h ^ c) * 0x01000193) & 0xFFFFFFFF
+	return h
+
+def swap16(data):
+	swapped = bytearray(data)
+	swapped[0::2] = data[1::2]
+	swapped[1::2] = data[0::2]
+	return bytes(swapped)
+
+def swap32(data):
+	swapped = bytearray(data)
+	for k in range(4):
+		swapped[k::4] = data[3-k::4]
+	return bytes(swapped)
+
+# the header stays big endian, the palette, the row offsets of rle textures and the texels of rgb565 ones are swapped (see src/texture_format.hpp)
+def swap_texture(data):
+	if data[0:2] == b"TX" and data[2] == 0x88:
+		palette_end = 12 + (data[3] + 1) * 2
+		rows = palette_end + (-palette_end) % 4
+		rows_end = rows + 4 * struct.unpack(">H", data[6:8])[0]
+		return data[:12] + swap16(data[12:palette_end]) + data[palette_end:rows] + swap32(data[rows:rows_end]) + data[rows_end:]
+	if data[0:2] == b"TX" and data[2] == 0x48:
+		end = 12 + (data[3] + 1) * 2
+		return data[:12] + swap16(data[12:end]) + data[end:]
+	if data[0:2] == b"TX":
+		end = 8 + (data[3] + 1) * 2
+		return data[:8] + swap16(data[8:end]) + data[end:]
+	return data[:4] + swap16(data[4:])
+
+def collect_assets(folder):
+	assets = []
+	for name in sorted(os.listdir(folder)):
+		path = os.path.join(folder, name)
+		if os.path.isfile(path) and name != pack_name:
+			assets.append((name, "T", path))
+	fnt_folder = os.path.join(folder, "fnt")
+	if os.path.isdir(fnt_folder):
+		for name in sorted(os.listdir(fnt_folder)):
+			assets.append(("fnt/" + name, "F", os.path.join(fnt_folder, name)))
+	return assets
+
+def write_pack(folder_name, byteorder = "big"):
+	folder = "res/" + folder_name
+	order = ">" if byteorder == "big" else "<"
+	entries = []
+	for name, kind, path in collect_assets(folder):
+		file = open(path, "rb")
+		data = file.read()
+		file.close()
+		if kind == "T" and byteorder != "big":
+			data = swap_texture(data) # the converted textures are big endian
+		entries.append((fnv1a(name), name, kind, data))
+	entries.sort()
+	for i in range(1, len(entries)):
+		if entries[i][0] == entries[i-1][0]:
+			raise ValueError("asset names " + entries[i-1][1] + " and " + entries[i][1] + " have the same hash")
+
+	names = b""
+	name_offsets = []
+	for name_hash, name, kind, data in entries:
+		if len(name) > 255 or 8 + 16 * len(entries) + len(names) > 0xFFFF:
+			raise ValueError("asset name " + name + " doesn't fit in the index")
+		name_offsets.append(8 + 16 * len(entries) + len(names))
+		names += name.encode("ascii")
+
+	offset = 8 + 16 * len(entries) + len(names)
+	index = b""
+	blobs = b""
+	for (name_hash, name, kind, data), name_offset in zip(entries, name_offsets):
+		padding = (-offset) % pack_alignment
+		blobs += b"\0" * padding
+		offset += padding
+		index += struct.pack(order + "III", name_hash, offset, len(data)) + kind.encode("ascii") + struct.pack(order + "BH", len(name), name_offset)
+		blobs += data
+		offset += len(data)
+
+	header = b"PAK2" + (b"B" if byteorder == "big" else b"L") + b"\0" + struct.pack(order + "H", len(entries))
+	asset_cache.write_if_changed(folder + "/" + pack_name, header + index + names + blobs)
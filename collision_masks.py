@@ -0,0 +1,43 @@
+# collision_masks.py
+
+# writes the 1-bit collision masks of the bird frames and the pipes into "src/collision_masks.hpp", from the converted textures in
+# "res/folder_name", so the masks always match what the game draws, the simulation tests them instead of the bounding boxes
+# (see src/lib/collision/mask.hpp), they're compiled in, so the headless simulation on the pc has them too
+# convert_textures.py calls write_header() after converting, "python3 collision_masks.py" redoes it from res alone
+#
+# every row of a mask is one uint64_t, the leftmost texel is the highest bit, so masks are up to 64 texels wide
+
+import os
+import asset_cache
+import embed_assets
+
+header_path = "src/collision_masks.hpp"
+# the textures that get a mask, the sliced pipes as their cap and their body row
+masked_textures = ["flappy0", "flappy1", "flappy2", "pipe0", "pipe0_body", "pipe1", "pipe1_body"]
+
+def mask_rows(rows):
+	return [sum(1 << (63 - x) for x, texel in enumerate(row) if texel != embed_assets.transparent) for row in rows]
+
+def mask_source(name, data):
+	texture = embed_assets.parse_texture(data)
+	if texture["w"] > 64:
+		raise ValueError("%s is %d texels wide, collision masks are up to 64" % (name, texture["w"]))
+	ident = "mask_" + "".join(c if c.isalnum() else "_" for c in name)
+	rows = mask_rows(texture["rows"])
+	out = "// %s: %dx%d\n" % (name, texture["w"], texture["h"])
+	out += "constexpr uint64_t %s_rows[] = {\n%s\n};\n" % (ident, "\n".join("\t0x%016XULL," % row for row in rows))
+	out += "constexpr CollisionMask %s = {%d, %d, %s_rows};\n\n" % (ident, texture["w"], texture["h"], ident)
+	return out
+
+def write_header(folder_name):
+	out = "// collision_masks.hpp, written by collision_masks.py from res/" + folder_name + ", don't edit\n"
+	out += "// included by lib/collision/mask.hpp\n\n"
+	out += "#pragma once\n\n"
+	for name in masked_textures:
+		file = open("res/" + folder_name + "/" + name, "rb")
+		out += mask_source(name, file.read())
+		file.close()
+	asset_cache.write_if_changed(header_path, out.encode("utf-8"))
+
+if __name__ == "__main__":
+	write_header(os.path.basename(os.getcwd()))
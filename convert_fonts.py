@@ -4,6 +4,7 @@
 # converted fonts are in 1-bit opacity and the image resolution (stored in 4 bytes) is added before the actual image data
 # there are 95 characters in total, in ASCII order (from 32 to 126, including space as the first character)
 # when making your font, arrange the characters in 19x5 configuration and ensure each character is the same size
+# like convert_textures.py, the fonts are converted as whole arrays, in parallel, and only when they changed (see asset_cache.py)
 
 # set a custom folder name to export textures to, or leave blank to automatically use this file's directory folder name
 folder_name = ""
@@ -13,51 +14,40 @@ pixel_color = (255, 255, 255)
 
 import glob
 import os
+import numpy
 from PIL import Image
+import asset_cache
+import asset_pack
+import embed_assets
 
 font_cols = 19
 font_rows = 5
 font_gap_x = 1
 font_gap_y = 1
 
-def uint16to8(input16):
-	return (input16 >> 8) & 0xFF, input16 & 0xFF
-
 if folder_name == "":
 	folder_name = os.path.basename(os.getcwd())
-fonts = []
-for imgpath in glob.iglob("fonts/**/*.png", recursive = True):
-	fonts.append(imgpath)
-for font in fonts:
-	imgobject = Image.open(font)
-	char_size_x = int(imgobject.size[0] / font_cols - font_gap_x)
-	char_size_y = int(imgobject.size[1] / font_rows - font_gap_y)
-	contents = [0] * (int(char_size_x * char_size_y * 95 / 8) + 5)
-	contents[0], contents[1] = uint16to8(char_size_x)
-	contents[2], contents[3] = uint16to8(char_size_y)
-	current_byte = 4
-	current_bit = 128
-	temp_byte = 0
-	imgpixels = imgobject.load()
-	for b in range(font_rows):
-		for a in range(font_cols):
-			for y in range(char_size_y):
-				for x in range(char_size_x):
-					pxl = imgpixels[a * (char_size_x + font_gap_x) + x, b * (char_size_y + font_gap_y) + y]
-					pxl = (pxl[0], pxl[1], pxl[2])
-					if pxl == (255, 255, 255):
-						temp_byte |= current_bit
-					current_bit >>= 1
-					if current_bit < 1:
-						contents[current_byte] = temp_byte
-						current_bit = 128
-						current_byte += 1
-						temp_byte = 0
-	if current_bit > 0:
-		contents[current_byte] = temp_byte
-	filepath = "res/" + folder_name + "/fnt/" + font[6:-4]
-	if not os.path.exists(os.path.dirname(filepath)):
-		os.makedirs(os.path.dirname(filepath))
-	file = open(filepath, "wb")
-	file.write(bytearray(contents))
-	file.close()
+
+# converts one png, runs in a worker process
+def convert_font(font):
+	rgb = numpy.asarray(Image.open(font).convert("RGB"))
+	char_size_x = int(rgb.shape[1] / font_cols - font_gap_x)
+	char_size_y = int(rgb.shape[0] / font_rows - font_gap_y)
+	lit = numpy.all(rgb == pixel_color, axis = 2)
+	# cut the characters out of the grid (dropping the gaps) and put them one after the other, each one row after row
+	cells = lit[:font_rows * (char_size_y + font_gap_y), :font_cols * (char_size_x + font_gap_x)]
+	cells = cells.reshape(font_rows, char_size_y + font_gap_y, font_cols, char_size_x + font_gap_x)[:, :char_size_y, :, :char_size_x]
+	bits = numpy.packbits(cells.transpose(0, 2, 1, 3).reshape(-1)).tobytes()
+	# the game reads one byte past the last full one
+	bits += bytes(char_size_x * char_size_y * 95 // 8 + 1 - len(bits))
+	header = bytes([(char_size_x >> 8) & 0xFF, char_size_x & 0xFF, (char_size_y >> 8) & 0xFF, char_size_y & 0xFF])
+	return [("res/" + folder_name + "/fnt/" + font[6:-4], header + bits)]
+
+if __name__ == "__main__":
+	fonts = sorted(path.replace(os.sep, "/") for path in glob.iglob("fonts/**/*.png", recursive = True))
+	settings = (folder_name, pixel_color, font_cols, font_rows, font_gap_x, font_gap_y)
+	asset_cache.convert_sources(fonts, "fonts", convert_font, asset_cache.converter_sha1(__file__, settings))
+
+	# repack the archive with everything converted so far, and write it out for builds with the assets built in
+	asset_pack.write_pack(folder_name)
+	embed_assets.write_header(folder_name)
@@ -2,47 +2,200 @@
 
 # this script converts pngs in the "textures" folder and saves them in the "res" folder which you then copy onto your Classpad
 # converted images are in rgb565 (taking up 2 bytes each pixel) and the image resolution (stored in 4 bytes) is added before the actual image data
+# with indexed_textures, images with few colours are stored as palette indices instead (see src/texture_format.hpp for all layouts)
+# the images are converted as whole arrays with numpy, in parallel, and only when they (or this script) changed since the last run (see asset_cache.py)
+# the collision masks of the bird and the pipes are made from the converted textures afterwards (see collision_masks.py)
 
 # set a custom folder name to export textures to, or leave blank to automatically use this file's directory folder name
 folder_name = ""
 # use this to ensure colors close to your transparency color don't become transparent when converted (because rgb565 has lower precision)
 transparency_color = (255, 0, 255)
+# store textures with up to 255 colours as a palette and 4-bit (up to 15 colours) or 8-bit indices, index 0 is transparent
+indexed_textures = True
+# compress the indices of each row into runs when that at least halves the texture, the game decodes them while drawing
+compressed_textures = True
+# textures (names without .png) that are cut into tiles of tile_size x tile_size texels, every different tile is stored once
+# restoring a small part of them is cheaper than with the compressed rows, use it for big backgrounds that repeat themselves
+tiled_textures = ["background"]
+# a power of 2 up to 128
+tile_size = 16
+# textures (names without .png) made of a cap and a body that repeats one row, like the pipes, are saved as the cap and a
+# single body row ("name_body"), the game repeats that row as far as it needs, rows that differ from the most common row by
+# at most slice_tolerance in each rgb565 channel count as body rows
+sliced_textures = ["pipe0", "pipe1"]
+slice_tolerance = 1
 
 
 import glob
 import os
+import numpy
 from PIL import Image
+import asset_cache
+import asset_pack
+import embed_assets
+import collision_masks
 
 def rgb888to565(rgbtuple):
 	return ((rgbtuple[0] & 0b11111000) << 8) + ((rgbtuple[1] & 0b11111100) << 3) + (rgbtuple[2] >> 3)
 
-def uint16to8(input16):
-	return (input16 >> 8) & 0xFF, input16 & 0xFF
-
 if folder_name == "":
 	folder_name = os.path.basename(os.getcwd())
-textures = []
-for imgpath in glob.iglob("textures/**/*.png", recursive = True):
-	textures.append(imgpath)
-for texture in textures:
-	imgobject = Image.open(texture)
-	contents = [0] * (imgobject.size[0] * imgobject.size[1] * 2 + 4)
-	contents[0], contents[1] = uint16to8(imgobject.size[0])
-	contents[2], contents[3] = uint16to8(imgobject.size[1])
-	i = 4
-	imgpixels = imgobject.load()
-	for y in range(imgobject.size[1]):
-		for x in range(imgobject.size[0]):
-			pxl = imgpixels[x, y]
-			pxl = (pxl[0], pxl[1], pxl[2])
-			pxl565 = rgb888to565(pxl)
-			if pxl565 == rgb888to565(transparency_color) and pxl != transparency_color:
-				pxl565 ^= 1
-			contents[i], contents[i+1] = uint16to8(pxl565)
-			i += 2
-	filepath = "res/" + folder_name + "/" + texture[9:-4]
-	if not os.path.exists(os.path.dirname(filepath)):
-		os.makedirs(os.path.dirname(filepath))
-	file = open(filepath, "wb")
-	file.write(bytearray(contents))
-	file.close()
+transparent = rgb888to565(transparency_color)
+
+def uint16be(values):
+	return numpy.asarray(values, dtype = ">u2").tobytes()
+
+def uint32be(values):
+	return numpy.asarray(values, dtype = ">u4").tobytes()
+
+# the image as an h x w array of rgb565 texels
+def load_texels(path):
+	rgb = numpy.asarray(Image.open(path).convert("RGB"), dtype = numpy.uint16)
+	texels = ((rgb[:, :, 0] & 0b11111000) << 8) | ((rgb[:, :, 1] & 0b11111100) << 3) | (rgb[:, :, 2] >> 3)
+	# colours that only become the transparency colour in rgb565 are moved one step away from it
+	texels[(texels == transparent) & numpy.any(rgb != transparency_color, axis = 2)] ^= 1
+	return texels
+
+# (value, length) of every run of equal values in a row
+def row_runs(row):
+	starts = numpy.flatnonzero(numpy.diff(row, prepend = row[0] ^ 1))
+	lengths = numpy.diff(numpy.append(starts, len(row)))
+	return zip(row[starts].tolist(), lengths.tolist())
+
+# packets: c < 128 followed by c+1 indices, c >= 128 followed by one index repeated c-125 times (3 to 130)
+def rle_row(row):
+	packets = bytearray()
+	literal = []
+	for value, length in row_runs(row):
+		while length >= 3:
+			if literal:
+				packets += bytes([len(literal) - 1] + literal)
+				literal = []
+			n = min(length, 130)
+			packets += bytes([n + 125, value])
+			length -= n
+		for _ in range(length):
+			if len(literal) == 128:
+				packets += bytes([len(literal) - 1] + literal)
+				literal = []
+			literal.append(value)
+	if literal:
+		packets += bytes([len(literal) - 1] + literal)
+	return bytes(packets)
+
+def rle_contents(w, h, palette, indices):
+	offsets = []
+	packets = bytearray()
+	seen = {}
+	for row in indices:
+		encoded = rle_row(row)
+		if encoded not in seen:
+			seen[encoded] = len(packets)
+			packets += encoded
+		offsets.append(seen[encoded])
+	contents = bytes([ord("T"), ord("X"), 0x88, len(palette) - 1]) + uint16be([w, h]) + uint32be([len(packets)]) + uint16be(palette)
+	contents += bytes((-len(contents)) % 4)
+	return contents + uint32be(offsets) + bytes(packets)
+
+# at most 256 different tiles, the map has one byte per tile
+# tiles of a single colour come first so the game can fill them instead of looking up every texel
+def tiled_contents(w, h, palette, indices):
+	columns = (w + tile_size - 1) // tile_size
+	tile_rows = (h + tile_size - 1) // tile_size
+	padded = numpy.zeros((tile_rows * tile_size, columns * tile_size), dtype = numpy.uint8)
+	padded[:h, :w] = indices
+	grid = padded.reshape(tile_rows, tile_size, columns, tile_size).swapaxes(1, 2).reshape(tile_rows * columns, tile_size * tile_size)
+	uniform = (grid.min(axis = 1) == grid.max(axis = 1)).tolist()
+	tile_map = []
+	tiles = []
+	single = []
+	seen = {}
+	for k, tile in enumerate(grid):
+		tile = tile.tobytes()
+		if tile not in seen:
+			seen[tile] = len(tiles)
+			tiles.append(tile)
+			single.append(uniform[k])
+		tile_map.append(seen[tile])
+	if len(tiles) > 256:
+		return None
+	order = sorted(range(len(tiles)), key = lambda t: not single[t])
+	solid = min(255, sum(single))
+	new_index = {t: k for k, t in enumerate(order)}
+	contents = bytes([ord("T"), ord("X"), 0x48, len(palette) - 1]) + uint16be([w, h])
+	contents += bytes([tile_size.bit_length() - 1, solid]) + uint16be([len(tiles)]) + uint16be(palette)
+	return contents + bytes(new_index[t] for t in tile_map) + b"".join(tiles[t] for t in order)
+
+# the palette lists the colours in the order they first appear, after the transparency colour at index 0
+def indexed_contents(texels, tiled):
+	h, w = texels.shape
+	colors, first, inverse = numpy.unique(texels, return_index = True, return_inverse = True)
+	appearance = [c for c in colors[numpy.argsort(first, kind = "stable")].tolist() if c != transparent]
+	palette = [transparent] + appearance
+	if len(palette) > 256:
+		return None
+	position = {c: k for k, c in enumerate(palette)}
+	lookup = numpy.array([position[c] for c in colors.tolist()], dtype = numpy.uint8)
+	indices = lookup[inverse.reshape(-1)].reshape(h, w)
+	if tiled:
+		tiled = tiled_contents(w, h, palette, indices)
+		if tiled is not None:
+			return tiled
+	bits = 4 if len(palette) <= 16 else 8
+	contents = bytes([ord("T"), ord("X"), bits, len(palette) - 1]) + uint16be([w, h]) + uint16be(palette)
+	if bits == 8:
+		contents += indices.tobytes()
+	else:
+		if w % 2:
+			indices = numpy.pad(indices, ((0, 0), (0, 1)))
+		contents += ((indices[:, 0::2] << 4) | indices[:, 1::2]).astype(numpy.uint8).tobytes()
+	if compressed_textures:
+		compressed = rle_contents(w, h, palette, indices[:, :w])
+		if len(compressed) * 2 <= len(contents):
+			return compressed
+	return contents
+
+# rows that are transparent in the same places and differ by at most slice_tolerance in each channel from row
+def similar_rows(rows, row):
+	channels = lambda t: numpy.stack([t >> 11, (t >> 5) & 63, t & 31], axis = -1).astype(numpy.int16)
+	close = numpy.all(numpy.abs(channels(rows) - channels(row)) <= slice_tolerance, axis = (-1, -2))
+	return close & numpy.all((rows == transparent) == (row == transparent), axis = -1)
+
+# returns [(name, texels)] for the cap and the body row, or only the texture itself when its body isn't at the top or bottom
+def slice_texture(name, texels):
+	h = texels.shape[0]
+	rows = [tuple(row) for row in texels.tolist()]
+	body = numpy.array(max(set(rows), key = rows.count), dtype = numpy.uint16)
+	similar = similar_rows(texels, body).tolist() + [False]
+	top = similar.index(False)
+	bottom = h - (similar[-2::-1] + [False]).index(False)
+	if top > 0 and bottom == h:
+		cap = texels[top:]
+	elif bottom < h and top == 0:
+		cap = texels[:bottom]
+	else:
+		return [(name, texels)]
+	return [(name, cap), (name + "_body", body.reshape(1, -1))]
+
+def texture_contents(name, texels):
+	contents = indexed_contents(texels, name in tiled_textures) if indexed_textures else None
+	if contents is None:
+		contents = uint16be(texels.shape[::-1]) + uint16be(texels)
+	return contents
+
+# converts one png, runs in a worker process
+def convert_texture(texture):
+	texels = load_texels(texture)
+	name = texture[9:-4]
+	parts = slice_texture(name, texels) if name in sliced_textures else [(name, texels)]
+	return [("res/" + folder_name + "/" + part, texture_contents(part, part_texels)) for part, part_texels in parts]
+
+if __name__ == "__main__":
+	textures = sorted(path.replace(os.sep, "/") for path in glob.iglob("textures/**/*.png", recursive = True))
+	settings = (folder_name, transparency_color, indexed_textures, compressed_textures, tiled_textures, tile_size, sliced_textures, slice_tolerance)
+	asset_cache.convert_sources(textures, "textures", convert_texture, asset_cache.converter_sha1(__file__, settings))
+
+	# repack the archive with everything converted so far, and write it out for builds with the assets built in
+	asset_pack.write_pack(folder_name)
+	embed_assets.write_header(folder_name)
+	collision_masks.write_header(folder_name)
@@ -0,0 +1,185 @@
+# embed_assets.py
+
+# writes every converted asset in "res/folder_name" into "src/embedded_assets.hpp", so a build with "make DEFINES=-DEMBEDDED_ASSETS"
+# carries the assets in the binary and draws them in place: no file is opened and nothing is allocated for them at startup
+# convert_textures.py and convert_fonts.py call write_header() after converting, "python3 embed_assets.py" redoes it from res alone
+#
+# the texture files are decoded here like texture_build_spans() and font_build_cache() do in the game, and written as the finished
+# Texture and Font structs with their opaque runs and glyph runs, the bulky arrays are const so they stay in .rodata
+# palettes, row offsets and rgb565 texels are written as numbers, so the header is the same for the calculator and the pc
+# the assets keep the names of the asset pack ("pipe0", "fnt/5x6"), the file based loaders are still used without EMBEDDED_ASSETS
+
+import os
+import struct
+import asset_cache
+import asset_pack
+
+header_path = "src/embedded_assets.hpp"
+transparent = 0xF81F # TRANSPARENCY_COLOR
+values_per_line = 24
+
+format_names = {0: "TEXTURE_RGB565", 4: "TEXTURE_INDEXED4", 8: "TEXTURE_INDEXED8", 0x88: "TEXTURE_RLE8", 0x48: "TEXTURE_TILED8"}
+
+def identifier(name):
+	return "embedded_" + "".join(c if c.isalnum() else "_" for c in name)
+
+def uint16s(data):
+	return list(struct.unpack(">%dH" % (len(data) // 2), data))
+
+def uint32s(data):
+	return list(struct.unpack(">%dI" % (len(data) // 4), data))
+
+# the runs of texels that aren't transparent, as (x, len)
+def row_spans(row):
+	spans = []
+	i = 0
+	while i < len(row):
+		while i < len(row) and row[i] == transparent:
+			i += 1
+		start = i
+		while i < len(row) and row[i] != transparent:
+			i += 1
+		if i > start:
+			spans.append((start, i - start))
+	return spans
+
+def rle_decode(packets, offset, w):
+	row = []
+	while len(row) < w:
+		c = packets[offset]
+		if c >= 128:
+			row += [packets[offset + 1]] * (c - 125)
+			offset += 2
+		else:
+			row += list(packets[offset + 1:offset + c + 2])
+			offset += c + 2
+	return row[:w]
+
+# the fields of the Texture struct (see texture_format.hpp for the layouts) and its rows in rgb565
+def parse_texture(data):
+	texture = {"palette": None, "row_offsets": None, "tile_map": None, "tile_shift": 0, "solid_tiles": 0}
+	if data[0:2] != b"TX":
+		w, h = struct.unpack(">HH", data[0:4])
+		texels = uint16s(data[4:4 + w * h * 2])
+		texture.update(w = w, h = h, format = 0, stride = w * 2, texels = texels)
+		texture["rows"] = [texels[y * w:(y + 1) * w] for y in range(h)]
+		return texture
+	fmt = data[2]
+	colors = data[3] + 1
+	w, h = struct.unpack(">HH", data[4:8])
+	texture.update(w = w, h = h, format = fmt)
+	if fmt == 0x48:
+		shift = data[8]
+		size = 1 << shift
+		tiles = struct.unpack(">H", data[10:12])[0]
+		columns = (w + size - 1) >> shift
+		map_start = 12 + colors * 2
+		texel_start = map_start + columns * ((h + size - 1) >> shift)
+		palette = uint16s(data[12:map_start])
+		tile_map = list(data[map_start:texel_start])
+		texels = list(data[texel_start:texel_start + tiles * size * size])
+		rows = [[texels[(tile_map[(y >> shift) * columns + (x >> shift)] << (2 * shift)) + ((y & (size - 1)) << shift) + (x & (size - 1))] for x in range(w)] for y in range(h)]
+		texture.update(stride = size, tile_map = tile_map, tile_shift = shift, solid_tiles = data[9])
+	elif fmt == 0x88:
+		packet_count = struct.unpack(">I", data[8:12])[0]
+		row_start = (12 + colors * 2 + 3) & ~3
+		texel_start = row_start + h * 4
+		palette = uint16s(data[12:12 + colors * 2])
+		row_offsets = uint32s(data[row_start:texel_start])
+		texels = list(data[texel_start:texel_start + packet_count])
+		rows = [rle_decode(texels, offset, w) for offset in row_offsets]
+		texture.update(stride = 0, row_offsets = row_offsets)
+	else:
+		stride = (w + 1) // 2 if fmt == 4 else w
+		palette = uint16s(data[8:8 + colors * 2])
+		texels = list(data[8 + colors * 2:8 + colors * 2 + stride * h])
+		if fmt == 4:
+			rows = [[(texels[y * stride + x // 2] >> (4 - 4 * (x & 1))) & 15 for x in range(w)] for y in range(h)]
+		else:
+			rows = [texels[y * stride:(y + 1) * stride] for y in range(h)]
+		texture.update(stride = stride)
+	texture.update(palette = palette, texels = texels)
+	texture["rows"] = [[palette[index] for index in row] for row in rows]
+	return texture
+
+def array(ctype, name, values, hexdigits):
+	lines = []
+	for k in range(0, len(values), values_per_line):
+		lines.append("\t" + ", ".join(("0x%0*X" % (hexdigits, v)) if hexdigits else str(v) for v in values[k:k + values_per_line]) + ",")
+	return "const %s %s[] = {\n%s\n};\n" % (ctype, name, "\n".join(lines))
+
+def pairs(ctype, name, values):
+	lines = []
+	for k in range(0, len(values), values_per_line // 2):
+		lines.append("\t" + ", ".join("{%d, %d}" % v for v in values[k:k + values_per_line // 2]) + ",")
+	return "const %s %s[] = {\n%s\n};\n" % (ctype, name, "\n".join(lines))
+
+def texture_source(name, data):
+	t = parse_texture(data)
+	ident = identifier(name)
+	row_spans_index = [0]
+	spans = []
+	for row in t["rows"]:
+		spans += row_spans(row)
+		row_spans_index.append(len(spans))
+	out = "// %s: %dx%d %s, %d byte file\n" % (name, t["w"], t["h"], format_names[t["format"]], len(data))
+	if t["palette"]:
+		out += array("uint16_t", ident + "_palette", t["palette"], 4)
+	if t["format"] == 0:
+		out += array("uint16_t", ident + "_texels", t["texels"], 4)
+	else:
+		out += array("uint8_t", ident + "_texels", t["texels"], 2)
+	if t["row_offsets"]:
+		out += array("uint32_t", ident + "_row_offsets", t["row_offsets"], 0)
+	if t["tile_map"]:
+		out += array("uint8_t", ident + "_tile_map", t["tile_map"], 0)
+	out += array("uint32_t", ident + "_row_spans", row_spans_index, 0)
+	# a texture without a single opaque texel still needs an array to point to
+	out += pairs("TextureSpan", ident + "_spans", spans or [(0, 0)])
+	fields = [str(t["w"]), str(t["h"]), format_names[t["format"]], str(t["stride"]),
+		ident + "_palette" if t["palette"] else "0",
+		("(const uint8_t*)" if t["format"] == 0 else "") + ident + "_texels",
+		ident + "_row_offsets" if t["row_offsets"] else "0",
+		ident + "_tile_map" if t["tile_map"] else "0",
+		str(t["tile_shift"]), str(t["solid_tiles"]), ident + "_row_spans", ident + "_spans", "0"]
+	out += "Texture %s = {%s};\n\n" % (ident, ", ".join(fields))
+	return out
+
+def font_source(name, data):
+	w, h = struct.unpack(">HH", data[0:4])
+	bits = data[4:]
+	ident = identifier(name)
+	row_runs = [0]
+	runs = []
+	for r in range(95 * h):
+		row = [0 if bits[(r * w + x) // 8] & (128 >> ((r * w + x) % 8)) else transparent for x in range(w)]
+		runs += row_spans(row)
+		row_runs.append(len(runs))
+	out = "// %s: %dx%d glyphs\n" % (name, w, h)
+	out += array("uint16_t", ident + "_row_runs", row_runs, 0)
+	out += pairs("GlyphRun", ident + "_runs", runs or [(0, 0)])
+	out += "Font %s = {%d, %d, %s_row_runs, %s_runs};\n\n" % (ident, w, h, ident, ident)
+	return out
+
+def write_header(folder_name):
+	assets = asset_pack.collect_assets("res/" + folder_name)
+	out = "// embedded_assets.hpp, written by embed_assets.py from res/" + folder_name + ", don't edit\n"
+	out += "// included by draw_functions.hpp when the game is built with EMBEDDED_ASSETS\n\n"
+	out += "#pragma once\n\n"
+	table = []
+	for name, kind, path in assets:
+		file = open(path, "rb")
+		data = file.read()
+		file.close()
+		if kind == "T":
+			out += texture_source(name, data)
+			table.append("\t{\"%s\", &%s, 0}," % (name, identifier(name)))
+		else:
+			out += font_source(name, data)
+			table.append("\t{\"%s\", 0, &%s}," % (name, identifier(name)))
+	out += "const EmbeddedAsset embeddedAssets[] = {\n" + "\n".join(table) + "\n};\n"
+	out += "const uint16_t embeddedAssetCount = %d;\n" % len(table)
+	asset_cache.write_if_changed(header_path, out.encode("utf-8"))
+
+if __name__ == "__main__":
+	write_header(os.path.basename(os.getcwd()))
@@ -0,0 +1,112 @@
+// arena.hpp
+
+// Region allocator for the assets, one block is taken from the heap at startup and handed out front to back
+// Nothing is freed on its own, arena_mark remembers how far the arena is used and arena_release hands back everything
+// allocated after it at once, so the game has a session scope (everything loaded at startup) and a level scope (what
+// a single game needs) and restarting only moves the end of the arena back, the heap isn't touched again
+// Every allocation is counted for the label that was set last, arena_label starts a new one (usually the asset name)
+
+#pragma once
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+// enough for the converted assets with room to spare, build with "make DEFINES=-DASSET_ARENA_SIZE=..." for bigger textures
+// with EMBEDDED_ASSETS the assets are in the binary and the arena only holds the pipe scroll tables, the text layouts
+// and the cached surfaces (see surface.hpp), so it's a smaller static block instead of heap
+#ifndef ASSET_ARENA_SIZE
+	#ifdef EMBEDDED_ASSETS
+		#define ASSET_ARENA_SIZE (48*1024)
+	#else
+		#define ASSET_ARENA_SIZE (96*1024)
+	#endif
+#endif
+
+#define ARENA_ALIGN 8
+#define ARENA_LABELS 24
+#define ARENA_LABEL_LENGTH 12
+
+struct ArenaLabel {
+	char name[ARENA_LABEL_LENGTH];
+	uint32_t bytes;
+};
+
+struct Arena {
+	uint8_t *base;
+	uint32_t size;
+	uint32_t used;
+	uint32_t highWater; // the most that was ever used
+	uint32_t failed; // bytes of allocations that didn't fit
+	uint8_t labelCount;
+	ArenaLabel labels[ARENA_LABELS];
+};
+
+// where the arena was, arena_release goes back to it
+struct ArenaMark {
+	uint32_t used;
+	uint8_t labelCount;
+	uint32_t labelBytes; // of the last label
+};
+
+Arena assetArena = {0, 0, 0, 0, 0, 0, {}};
+ArenaMark sessionScope = {0, 0, 0};
+ArenaMark levelScope = {0, 0, 0};
+
+#ifdef EMBEDDED_ASSETS
+	alignas(ARENA_ALIGN) uint8_t arenaBlock[ASSET_ARENA_SIZE];
+#endif
+
+bool arena_init(Arena *arena, uint32_t size) {
+	#ifdef EMBEDDED_ASSETS
+		arena->base = size <= ASSET_ARENA_SIZE ? arenaBlock : 0;
+	#else
+		arena->base = (uint8_t*)malloc(size);
+	#endif
+	arena->size = arena->base ? size : 0;
+	arena->used = 0;
+	arena->highWater = 0;
+	arena->failed = 0;
+	arena->labelCount = 0;
+	return arena->base != 0;
+}
+
+void arena_destroy(Arena *arena) {
+	#ifndef EMBEDDED_ASSETS
+		free(arena->base);
+	#endif
+	*arena = {0, 0, 0, 0, 0, 0, {}};
+}
+
+// 0 when it doesn't fit, the arena never grows
+void *arena_alloc(Arena *arena, uint32_t size) {
+	uint32_t start = (arena->used + ARENA_ALIGN - 1) & ~(uint32_t)(ARENA_ALIGN - 1);
+	if (start > arena->size || size > arena->size - start) {
+		arena->failed += size;
+		return 0;
+	}
+	if (arena->labelCount) arena->labels[arena->labelCount-1].bytes += start + size - arena->used;
+	arena->used = start + size;
+	if (arena->used > arena->highWater) arena->highWater = arena->used;
+	return arena->base + start;
+}
+
+inline ArenaMark arena_mark(Arena *arena) {
+	return {arena->used, arena->labelCount, arena->labelCount ? arena->labels[arena->labelCount-1].bytes : 0};
+}
+
+// releases everything allocated since the mark, including the labels that were started after it
+inline void arena_release(Arena *arena, ArenaMark mark) {
+	arena->labelCount = mark.labelCount;
+	if (mark.labelCount) arena->labels[mark.labelCount-1].bytes = mark.labelBytes;
+	arena->used = mark.used;
+}
+
+// counts the following allocations for name, when every label is taken they're added to the last one
+void arena_label(Arena *arena, const char *name) {
+	if (arena->labelCount == ARENA_LABELS) return;
+	ArenaLabel *label = &arena->labels[arena->labelCount++];
+	strncpy(label->name, name, ARENA_LABEL_LENGTH - 1);
+	label->name[ARENA_LABEL_LENGTH - 1] = 0;
+	label->bytes = 0;
+}
@@ -0,0 +1,187 @@
+// asset_pack.hpp
+
+// Reads the archive written by asset_pack.py: a header, an index sorted by name hash, the names and the asset files, each aligned to 16 bytes
+// The archive is read into the asset arena (or mapped on the pc) and the loaders point straight into it, nothing gets copied
+// asset_pack_begin and asset_pack_continue read it in chunks between frames
+// Palettes and texels in an archive of the other byte order are swapped once when it's opened
+// the loader (lib/core/loader.hpp) opens it, load_texture and load_font fall back to the loose files when it's missing
+
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "texture_format.hpp"
+#include "arena.hpp"
+
+#if defined(PC) && !defined(_WIN32)
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+	#define ASSET_PACK_MMAP
+#endif
+
+#define ASSET_PACK_NAME "assets.pak"
+
+struct AssetPackEntry {
+	uint32_t hash;
+	uint32_t offset;
+	uint32_t size;
+	uint8_t type; // 'T' texture, 'F' font
+	uint8_t nameLength;
+	uint8_t nameOffset[2]; // from the start of the file, in the byte order of the archive, unaligned
+};
+
+struct AssetPack {
+	uint8_t *data; // the whole file
+	uint32_t size;
+	uint16_t count;
+	AssetPackEntry *entries;
+	bool mapped;
+};
+
+AssetPack assetPack = {0, 0, 0, 0, false};
+
+// 32-bit FNV-1a, the same as asset_pack.py
+inline uint32_t asset_hash(const char *name) {
+	uint32_t h = 0x811C9DC5;
+	while (*name) h = (h ^ (uint8_t)*name++) * 0x01000193;
+	return h;
+}
+
+inline uint16_t asset_name_offset(const AssetPackEntry *entry) {
+	uint16_t offset;
+	memcpy(&offset, entry->nameOffset, 2);
+	return offset;
+}
+
+inline uint32_t swap32(uint32_t v) {
+	return (v >> 24) | ((v >> 8) & 0xFF00) | ((v << 8) & 0xFF0000) | (v << 24);
+}
+
+// checks the header and the index and brings everything into the byte order of this machine, false if the file isn't usable
+bool asset_pack_prepare(uint8_t *data, uint32_t size) {
+	if (size < 8 || memcmp(data, "PAK2", 4) != 0) return false;
+	#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+		bool swap = data[4] == 'B';
+	#else
+		bool swap = data[4] == 'L';
+	#endif
+	uint16_t count = *(uint16_t*)(data + 6);
+	if (swap) count = (count << 8) | (count >> 8);
+	if (8 + count*sizeof(AssetPackEntry) > size) return false;
+	AssetPackEntry *entries = (AssetPackEntry*)(data + 8);
+	for (uint16_t e = 0; e < count; e++) {
+		if (swap) {
+			entries[e].hash = swap32(entries[e].hash);
+			entries[e].offset = swap32(entries[e].offset);
+			entries[e].size = swap32(entries[e].size);
+			uint8_t byte = entries[e].nameOffset[0];
+			entries[e].nameOffset[0] = entries[e].nameOffset[1];
+			entries[e].nameOffset[1] = byte;
+		}
+		if (asset_name_offset(&entries[e]) + entries[e].nameLength > size) return false;
+		if (entries[e].offset > size || entries[e].size > size - entries[e].offset) return false;
+		if (entries[e].type == 'T') {
+			TextureFileInfo info;
+			if (entries[e].size < TEXTURE_HEADER_PEEK || !texture_file_info(data + entries[e].offset, &info) || info.size > entries[e].size) return false;
+			if (swap) texture_file_swap(data + entries[e].offset);
+		}
+	}
+	if (swap) {
+		// only touch the header when it changes, a mapped archive keeps sharing its pages with the file otherwise
+		*(uint16_t*)(data + 6) = count;
+		data[4] = data[4] == 'B' ? 'L' : 'B';
+	}
+	assetPack = {data, size, count, entries, false};
+	return true;
+}
+
+// reads the archive a chunk at a time, so a loading screen can keep drawing in between
+struct AssetPackReader {
+	FILE *fd; // 0 once the archive is complete (or was mapped)
+	uint8_t *data;
+	uint32_t size;
+	uint32_t read;
+	ArenaMark mark; // released again when the archive turns out to be unusable
+};
+
+// starts reading the archive into the arena, false if there isn't one, a mapped archive is complete right away
+bool asset_pack_begin(AssetPackReader *reader, const char *path, Arena *arena) {
+	*reader = {0, 0, 0, 0, arena_mark(arena)};
+	if (assetPack.data) return true;
+	#ifdef ASSET_PACK_MMAP
+		int fd = open(path, O_RDONLY);
+		if (fd < 0) return false;
+		struct stat st;
+		void *map = fstat(fd, &st) == 0 ? mmap(0, st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0) : MAP_FAILED;
+		close(fd);
+		if (map == MAP_FAILED) return false;
+		// private pages: only the pages of a swapped archive ever get copied
+		if (!asset_pack_prepare((uint8_t*)map, st.st_size)) {
+			munmap(map, st.st_size);
+			return false;
+		}
+		assetPack.mapped = true;
+		return true;
+	#else
+		FILE *fd = fopen(path, "rb");
+		if (!fd) return false;
+		fseek(fd, 0, SEEK_END);
+		long size = ftell(fd);
+		fseek(fd, 0, SEEK_SET);
+		arena_label(arena, ASSET_PACK_NAME);
+		uint8_t *data = size > 0 ? (uint8_t*)arena_alloc(arena, size) : 0;
+		if (!data) {
+			fclose(fd);
+			arena_release(arena, reader->mark);
+			return false;
+		}
+		*reader = {fd, data, (uint32_t)size, 0, reader->mark};
+		return true;
+	#endif
+}
+
+// reads up to chunk more bytes, true once the reader is done, assetPack.data tells if the archive was usable
+bool asset_pack_continue(AssetPackReader *reader, Arena *arena, uint32_t chunk) {
+	if (!reader->fd) return true;
+	uint32_t n = reader->size - reader->read < chunk ? reader->size - reader->read : chunk;
+	bool ok = fread(reader->data + reader->read, 1, n, reader->fd) == n;
+	reader->read += n;
+	if (ok && reader->read < reader->size) return false;
+	fclose(reader->fd);
+	reader->fd = 0;
+	if (!ok || !asset_pack_prepare(reader->data, reader->size)) arena_release(arena, reader->mark);
+	return true;
+}
+
+// a pack that was read goes away with the scope of the arena it was read into
+void close_asset_pack() {
+	if (!assetPack.data) return;
+	#ifdef ASSET_PACK_MMAP
+		if (assetPack.mapped) munmap(assetPack.data, assetPack.size);
+	#endif
+	assetPack = {0, 0, 0, 0, false};
+}
+
+// binary search of the index, 0 when the archive isn't open or doesn't have the asset
+// the hash only finds the entry, the name has to match too
+uint8_t *find_asset(const char *name, uint8_t type, uint32_t *size) {
+	uint32_t hash = asset_hash(name);
+	size_t length = strlen(name);
+	int lo = 0, hi = assetPack.count - 1;
+	while (lo <= hi) {
+		int mid = (lo + hi) / 2;
+		AssetPackEntry *entry = &assetPack.entries[mid];
+		if (entry->hash < hash) lo = mid + 1;
+		else if (entry->hash > hash) hi = mid - 1;
+		else {
+			if (entry->type != type || entry->nameLength != length || memcmp(assetPack.data + asset_name_offset(entry), name, length) != 0) return 0;
+			if (size) *size = entry->size;
+			return assetPack.data + entry->offset;
+		}
+	}
+	return 0;
+}
@@ -1,4 +1,6 @@
 #include "calc.hpp"
+#include "fill_functions.hpp"
+#include "triangle_functions.hpp"
 
 extern void main2(); //in file main.cpp
 
@@ -9,6 +11,7 @@ extern void main2(); //in file main.cpp
 	SDL_Texture *texture;
 	int width;
 	int height;
+	uint16_t *vram = nullptr;
 #else
     uint16_t *vram = nullptr;
 	uint8_t debugprintline = 0;
@@ -17,6 +20,12 @@ extern void main2(); //in file main.cpp
 	int height;
 #endif
 
+DirtyRect dirtyRects[maxDirtyRects];
+uint8_t dirtyRectCount = 0;
+DirtyRect dirtyPixelBox = {32767, 32767, -32768, -32768};
+uint32_t dirtyStatPixels = 0;
+uint8_t dirtyStatRects = 0;
+
 
 #ifdef PC
 extern "C" int main(){
@@ -27,12 +36,22 @@ int main(){
 	#ifdef PC
 		width  = 320;
 		height = 528;
+		vram = (uint16_t*)calloc(width*height, sizeof(uint16_t));
 		SDL_Init(SDL_INIT_EVERYTHING);
-		win = SDL_CreateWindow("CP3D", 100,100,width,height,SDL_WINDOW_SHOWN);
+		//Scale the window by the largest whole number that still fits on the desktop, so every calculator pixel stays square
+		int scale = 1;
+		SDL_DisplayMode display;
+		if (SDL_GetDesktopDisplayMode(0, &display) == 0) {
+			while (width*(scale+1) <= display.w && height*(scale+1) <= display.h - 64) scale++;
+		}
+		SDL_SetHint(SDL_HINT_RENDER_SCALE_QUALITY, "0");
+		win = SDL_CreateWindow("CP3D", SDL_WINDOWPOS_CENTERED,SDL_WINDOWPOS_CENTERED,width*scale,height*scale,SDL_WINDOW_SHOWN|SDL_WINDOW_RESIZABLE);
 		renderer = SDL_CreateRenderer(win, -1, 0);
+		SDL_RenderSetLogicalSize(renderer, width, height);
+		SDL_RenderSetIntegerScale(renderer, SDL_TRUE);
 		SDL_SetRenderDrawColor(renderer, 0, 255, 0, 255);
 		SDL_RenderClear(renderer);
-		texture = SDL_CreateTexture(renderer,SDL_PIXELFORMAT_RGBA8888,SDL_TEXTUREACCESS_TARGET,320,528);
+		texture = SDL_CreateTexture(renderer,SDL_PIXELFORMAT_ARGB8888,SDL_TEXTUREACCESS_STREAMING,width,height);
 	#else
 		vram = LCD_GetVRAMAddress();
 		LCD_GetSize((unsigned int*)&width, (unsigned int*)&height);
@@ -44,8 +63,11 @@ int main(){
 
 	//Stopping everything
 	#ifdef PC
+		SDL_DestroyTexture(texture);
+		SDL_DestroyRenderer(renderer);
 		SDL_DestroyWindow(win);
 		SDL_Quit();
+		free(vram);
 	#else
 		// LCD_VRAMRestore(); // Removed
 		LCD_Refresh();
@@ -70,9 +92,112 @@ void println(const char str[],int a,int b,int c,int d){
 #endif
 }
 
+//Rectangles closer than this many wasted pixels are merged, one bigger upload is cheaper than two small ones
+const int32_t dirtyMergeSlack = 1024;
+
+static inline int32_t rectArea(const DirtyRect &r){ return (int32_t)(r.x2-r.x1) * (r.y2-r.y1); }
+
+static inline DirtyRect rectUnion(const DirtyRect &a, const DirtyRect &b){
+	return {a.x1<b.x1 ? a.x1 : b.x1, a.y1<b.y1 ? a.y1 : b.y1, a.x2>b.x2 ? a.x2 : b.x2, a.y2>b.y2 ? a.y2 : b.y2};
+}
+
+//Adds a clipped, non empty rectangle. It's merged into the first rectangle where that wastes at most dirtyMergeSlack pixels,
+//the grown rectangle is then merged again with the others it got close to. When the list is full it's merged where it grows the least.
+static void addDirtyRect(DirtyRect r){
+	for (;;) {
+		int merge = -1;
+		for (int i=0; i<dirtyRectCount; i++) {
+			if (rectArea(rectUnion(dirtyRects[i], r)) <= rectArea(dirtyRects[i]) + rectArea(r) + dirtyMergeSlack) { merge = i; break; }
+		}
+		if (merge<0 && dirtyRectCount<maxDirtyRects) {
+			dirtyRects[dirtyRectCount++] = r;
+			return;
+		}
+		if (merge<0) {
+			int32_t best = 0x7FFFFFFF;
+			for (int i=0; i<dirtyRectCount; i++) {
+				int32_t growth = rectArea(rectUnion(dirtyRects[i], r)) - rectArea(dirtyRects[i]);
+				if (growth<best) { best = growth; merge = i; }
+			}
+		}
+		//take the rectangle out of the list and try again with the union
+		r = rectUnion(dirtyRects[merge], r);
+		dirtyRects[merge] = dirtyRects[--dirtyRectCount];
+	}
+}
+
+void markDirty(int x, int y, int w, int h){
+	int x2 = x+w, y2 = y+h;
+	if (x<0) x=0;
+	if (y<0) y=0;
+	if (x2>width) x2=width;
+	if (y2>height) y2=height;
+	if (x>=x2 || y>=y2) return;
+	addDirtyRect({(int16_t)x, (int16_t)y, (int16_t)x2, (int16_t)y2});
+}
+
+//Moves the pixel box into the list and records the statistics of the frame
+static void collectDirty(){
+	if (dirtyPixelBox.x1 < dirtyPixelBox.x2) {
+		addDirtyRect(dirtyPixelBox);
+		dirtyPixelBox = {32767, 32767, -32768, -32768};
+	}
+	dirtyStatRects = dirtyRectCount;
+	dirtyStatPixels = 0;
+	for (int i=0; i<dirtyRectCount; i++) dirtyStatPixels += rectArea(dirtyRects[i]);
+}
+
+#ifdef PC
+void refreshDirty(){
+	LCD_Refresh();
+}
+#else
+//The calculator's LCD_Refresh always sends the whole panel, the only saving is a frame where nothing changed
+void refreshDirty(){
+	collectDirty();
+	if (dirtyRectCount>0) LCD_Refresh();
+	dirtyRectCount = 0;
+}
+#endif
+
 //Define LCD_Refresh for the pc (for the calc this is in debug.hpp)
 #ifdef PC
+//Convert rgb565 pixels to ARGB8888. The loop has no branches and no dependencies between pixels so the compiler vectorises it
+//(gcc only does that from -O3 on, so it is asked to for this function; clang already does at -O2).
+//The top bits of each channel are repeated into the new low bits, so 0xFFFF becomes full white and 0x0000 stays black.
+#if defined(__GNUC__) && !defined(__clang__)
+__attribute__((optimize("tree-vectorize", "vect-cost-model=dynamic")))
+#endif
+static void rgb565ToArgb8888(const uint16_t *__restrict src, uint32_t *__restrict dst, int count){
+	for (int i = 0; i < count; i++) {
+		uint32_t p = src[i];
+		uint32_t r = (p >> 11) & 0x1F;
+		uint32_t g = (p >> 5) & 0x3F;
+		uint32_t b = p & 0x1F;
+		r = (r << 3) | (r >> 2);
+		g = (g << 2) | (g >> 4);
+		b = (b << 3) | (b >> 2);
+		dst[i] = 0xFF000000 | (r << 16) | (g << 8) | b;
+	}
+}
+
+//Everything is drawn into vram, so this is the only place that talks to the gpu.
+//Only the dirty rectangles are converted and uploaded, the rest of the texture still holds the last frame.
 void LCD_Refresh(){
+	collectDirty();
+	for (int i = 0; i < dirtyRectCount; i++) {
+		DirtyRect *d = &dirtyRects[i];
+		SDL_Rect rect = {d->x1, d->y1, d->x2 - d->x1, d->y2 - d->y1};
+		void *pixels;
+		int pitch;
+		if (SDL_LockTexture(texture, &rect, &pixels, &pitch) == 0) {
+			for (int y = 0; y < rect.h; y++)
+				rgb565ToArgb8888(vram + (rect.y+y)*width + rect.x, (uint32_t*)((uint8_t*)pixels + y*pitch), rect.w);
+			SDL_UnlockTexture(texture);
+		}
+	}
+	dirtyRectCount = 0;
+	SDL_RenderClear(renderer);
 	SDL_RenderCopy(renderer, texture, NULL, NULL);
 	SDL_RenderPresent(renderer);
 }
@@ -87,16 +212,105 @@ void delay(uint32_t time){
 	#endif	
 }
 
-//This is defined in sdk/calc/calc.cpp for the calc...
-// But we enable it here for compatibility if SDK doesn't provide it
-// #ifdef PC
-//Draw a line (bresanham line algorithm)
+//Horizontal line from x1 to x2 (both included) on row y, clipped once and written straight into vram
+void hline(int x1, int x2, int y, uint16_t color){
+	if (x1>x2) { int z=x2; x2=x1; x1=z;}
+	if (y<0 || y>=height || x2<0 || x1>=width) return;
+	if (x1<0) x1=0;
+	if (x2>=width) x2=width-1;
+	rgb565_fill(vram + y*width + x1, x2-x1+1, color);
+	markDirty(x1, y, x2-x1+1, 1);
+}
+
+//Vertical line from y1 to y2 (both included) in column x, clipped once and written with a stride of one row
+void vline(int x, int y1, int y2, uint16_t color){
+	if (y1>y2) { int z=y2; y2=y1; y1=z;}
+	if (x<0 || x>=width || y2<0 || y1>=height) return;
+	if (y1<0) y1=0;
+	if (y2>=height) y2=height-1;
+	uint16_t *p = vram + y1*width + x;
+	for (int y=y1; y<=y2; y++, p+=width)
+		*p = color;
+	markDirty(x, y1, 1, y2-y1+1);
+}
+
+//Filled rectangle with the top left corner at x, y
+void fillRect(int x, int y, int w, int h, uint16_t color){
+	if (x<0) { w+=x; x=0; }
+	if (y<0) { h+=y; y=0; }
+	if (x+w>width) w=width-x;
+	if (y+h>height) h=height-y;
+	if (w<=0 || h<=0) return;
+	rgb565_fill_rect(vram + y*width + x, width, w, h, color);
+	markDirty(x, y, w, h);
+}
+
+//Bresenham along the major axis a with the minor axis b (da >= db >= 1, da >= 2).
+//This steps exactly like the original line(): the error starts at 0, gains db per step and b moves when it reaches da/2.
+//That means after k steps b has moved n(k) = (k*db - da/2 + da) / da times, so instead of testing every pixel
+//the visible range of k is computed once and the loop writes to vram without any bounds checks.
+static void clippedBresenham(int a1, int b1, int da, int db, int ia, int ib, int aLimit, int bLimit, int aStride, int bStride, uint16_t color){
+	int half = da>>1;
+	//steps for which a is on screen
+	int kMin = ia>0 ? -a1 : a1-(aLimit-1);
+	int kMax = ia>0 ? aLimit-1-a1 : a1;
+	//number of minor steps for which b is on screen
+	int nMin = ib>0 ? -b1 : b1-(bLimit-1);
+	int nMax = ib>0 ? bLimit-1-b1 : b1;
+	if (nMax<0) return;
+	if (nMin>0) {
+		//first k with n(k) >= nMin
+		int first = ((nMin-1)*da + half + db-1) / db;
+		if (first>kMin) kMin = first;
+	}
+	if (nMax<db) {
+		//last k with n(k) <= nMax (n(da) is db, so nothing to clip otherwise)
+		int last = (nMax*da + half - 1) / db;
+		if (last<kMax) kMax = last;
+	}
+	if (kMin<0) kMin = 0;
+	if (kMax>da) kMax = da;
+	if (kMin>kMax) return;
+
+	int n = (kMin*db - half + da) / da;
+	int error = kMin*db - n*da;
+	//aStride*ia and bStride*ib are the distances in vram of one unit along a and b
+	uint16_t *p = vram + (a1 + ia*kMin)*aStride*ia + (b1 + ib*n)*bStride*ib;
+	for (int k=kMin; ; k++) {
+		*p = color;
+		if (k==kMax) break;
+		p += aStride;
+		error += db;
+		if (error>=half) {
+			p += bStride;
+			error -= da;
+		}
+	}
+}
+
+//Draw a line.
+//Horizontal and vertical lines go straight to hline and vline,
+//everything else is the bresenham line algorithm clipped against the screen once.
 void line(int x1, int y1, int x2, int y2, uint16_t color){
+	if (y1==y2) { hline(x1, x2, y1, color); return; }
+	if (x1==x2) { vline(x1, y1, y2, color); return; }
+
 	int8_t ix, iy;
 
 	int dx = (x2>x1 ? (ix=1, x2-x1) : (ix=-1, x1-x2) );
 	int dy = (y2>y1 ? (iy=1, y2-y1) : (iy=-1, y1-y2) );
 
+	//The clipped bresenham needs coordinates within +-16383 (further out the clipping math could overflow) and dx and dy of at least 2,
+	//every other line is drawn below one setPixel at a time, each pixel checked against the screen
+	const int far = 16383;
+	bool small = x1>-far && x1<far && y1>-far && y1<far && x2>-far && x2<far && y2>-far && y2<far;
+	if (small && dx>=2 && dy>=2) {
+		markDirty(x1<x2 ? x1 : x2, y1<y2 ? y1 : y2, dx+1, dy+1);
+		if (dx>=dy) clippedBresenham(x1, y1, dx, dy, ix, iy, width, height, ix, iy*width, color);
+		else        clippedBresenham(y1, x1, dy, dx, iy, ix, height, width, iy*width, ix, color);
+		return;
+	}
+
 	setPixel(x1,y1,color);
 	if(dx>=dy){ //the derivative is less than 1 (not so steep)
 		//y1 is the whole number of the y value
@@ -127,83 +341,18 @@ void line(int x1, int y1, int x2, int y2, uint16_t color){
 	}
 }
 
-void vline(int x, int y1, int y2, uint16_t color){
-	if (y1>y2) { int z=y2; y2=y1; y1=z;}
-	for (int y=y1; y<=y2; y++)
-		setPixel(x,y,color);
-}
-
-//Draw a filled triangle.
+//Draw a filled triangle, the rows come from triangle_spans (triangle_functions.hpp) and are filled straight in vram.
+//It uses the top-left fill rule, so triangles that share an edge never draw the shared pixels twice and never leave a gap between them.
 void triangle(int x0, int y0, int x1, int y1, int x2, int y2, uint16_t colorFill, uint16_t colorLine){
-//Filled triangles are a lot of vertical lines.
-/*                                                               -
-                        a   ___________----------P3              -
-       P0 _________---------              ____---                -
-          ---____               _____-----                       -
-               b ----___  _-----   c                             -
-                        P2                                       -
-The triangle has three points P0, P1 and P2 and three lines a, b and c. We go from left to right, calculating the point on a and the point on b or c and then we draw a vertical line connecting these two.
-*/
-//Sort the points by x coordinate
-	{int z;
-	if(x0>x2){ z=x2; x2=x0; x0=z; z=y2; y2=y0; y0=z; }
-	if(x1>x2){ z=x2; x2=x1; x1=z; z=y2; y2=y1; y1=z; }
-	if(x0>x1){ z=x1; x1=x0; x0=z; z=y1; y1=y0; y0=z; }}
-
-	int x = x0; //x is the variable that counts from left to right
-
-	//Values for line a
-	int ay = y0; //The point y for the current x on the line a
-	int aiy; //The direction of line a
-	int adx = (x2>x0 ? (       x2-x0) : (        x0-x2) );
-	int ady = (y2>y0 ? (aiy=1, y2-y0) : (aiy=-1, y0-y2) );
-	int aerr = 0; //The y value of a (fractional part). y is actually ay+(aerr/adx)
-
-	//Values for line b
-	int by = y0; //The point y for the current x on the line b
-	int biy; //The direction of line b
-	int bdx = (x1>x0 ? (       x1-x0) : (        x0-x1) );
-	int bdy = (y1>y0 ? (biy=1, y1-y0) : (biy=-1, y0-y1) );
-	int berr = 0;
-
-	//Values for line c
-	int cy = y1; //The point y for the current x on the line y (starting at P1)
-	int ciy; //The direction of line c
-	int cdx = (x2>x1 ? (       x2-x1) : (        x1-x2) );
-	int cdy = (y2>y1 ? (ciy=1, y2-y1) : (ciy=-1, y1-y2) );
-	int cerr = 0;
-
-	//First draw area between a and b
-	while (x<x1){
-		x++;
-		aerr+=ady;
-		while(aerr>=adx >> 2){ //if aerr/adx >= 0.5
-			aerr-=adx;
-			ay+=aiy;
-		}
-		berr+=bdy;
-		while(berr>=bdx >> 2){ //if berr/bdx >= 0.5
-			berr-=bdx;
-			by+=biy;
-		}
-		vline(x,ay,by,colorFill);
-	}
-
-	//Then draw area between a and c
-	while (x<x2-1){ //we don't need x=x2
-		x++;
-		aerr+=ady;
-		while(aerr>=adx >> 2){ //if aerr/adx >= 0.5
-			aerr-=adx;
-			ay+=aiy;
-		}
-		cerr+=cdy;
-		while(cerr>=cdx >> 2){ //if berr/bdx >= 0.5
-			cerr-=cdx;
-			cy+=ciy;
-		}
-		vline(x,ay,cy,colorFill);
-	}
+	int dirtyLeft = width, dirtyRight = -1, dirtyTop = height, dirtyBottom = -1;
+	triangle_spans(x0, y0, x1, y1, x2, y2, width, height, [&](int y, int left, int right){
+		rgb565_fill(vram + y*width + left, right-left+1, colorFill);
+		if (left<dirtyLeft) dirtyLeft = left;
+		if (right>dirtyRight) dirtyRight = right;
+		if (y<dirtyTop) dirtyTop = y;
+		dirtyBottom = y;
+	});
+	if (dirtyRight>=0) markDirty(dirtyLeft, dirtyTop, dirtyRight-dirtyLeft+1, dirtyBottom-dirtyTop+1);
 
 	line(x0,y0,x1,y1,colorLine);
 	line(x1,y1,x2,y2,colorLine);
@@ -211,30 +360,9 @@ The triangle has three points P0, P1 and P2 and three lines a, b and c. We go fr
 }
 
 void fillScreen(uint16_t color){
-	#ifdef PC
-		unsigned char pixels[4]; // { A, B, G, R }
-		//Convert 565 colors to RGBA
-		/*R*/ pixels[3] = (color >> 8) & 0b11111000;
-		/*G*/ pixels[2] = (color >> 3) & 0b11111100;
-		/*B*/ pixels[1] = (color << 3) & 0b11111000;
-		/*A*/ pixels[0] = 0;
-
-		//create an array with the whole screen filled with this color
-		unsigned char screen[4*width*height] ;
-		for(long i=0;i<(width*height);i++){
-			screen[4*i + 0] = pixels[0];
-			screen[4*i + 1] = pixels[1];
-			screen[4*i + 2] = pixels[2];
-			screen[4*i + 3] = pixels[3];
-		}
-		SDL_Rect rect;
-		rect.x = 0; rect.y = 0; rect.w =width; rect.h = height;
-		SDL_UpdateTexture(texture, &rect , (void*)screen, 4*width); //The last number defines the number of bytes per row. ( width * bytePerPixel )
-	#else
-		const uint32_t size = width * height;
-		for(uint32_t i = 0; i<size;i++)
-			*((uint16_t*)( (uint32_t)vram + ( i*2 )  )) = color;
-	#endif
+	//The pc renders into its own vram too
+	rgb565_fill(vram, width * height, color);
+	markDirty(0, 0, width, height);
 }
 
 //for the pc getKey is written in c++, for the calculator this is written in asm in the file getKey.s
@@ -10,6 +10,8 @@
 	extern SDL_Texture *texture;
 	extern int width;
 	extern int height;
+	// software framebuffer in the same rgb565 layout as the calculator's vram, uploaded once per LCD_Refresh
+	extern uint16_t *vram;
 #else
 	#include <sdk/os/debug.h>
 	#include <sdk/os/lcd.h>
@@ -31,6 +33,34 @@ void println(const char str[],int a,int b,int c,int d);
 
 void delay(uint32_t time);
 
+// clipped against the screen once, then written straight into vram (see calc.cpp)
+void hline(int x1, int x2, int y, uint16_t color);
+void vline(int x, int y1, int y2, uint16_t color);
+void fillRect(int x, int y, int w, int h, uint16_t color);
+
+// dirty rectangles: everything that writes to vram reports the area it touched, LCD_Refresh on the pc only uploads those
+// x2 and y2 are exclusive
+struct DirtyRect {
+	int16_t x1, y1, x2, y2;
+};
+const uint8_t maxDirtyRects = 8;
+extern DirtyRect dirtyRects[maxDirtyRects];
+extern uint8_t dirtyRectCount;
+extern DirtyRect dirtyPixelBox; // single pixels only grow a bounding box, it joins the rectangles at the refresh
+// statistics of the last refreshed frame, for the debug overlay
+extern uint32_t dirtyStatPixels;
+extern uint8_t dirtyStatRects;
+
+void markDirty(int x, int y, int w, int h); // clipped to the screen, merged with the rectangles it's close to
+void refreshDirty(); // presents the frame, skipping it when nothing was drawn since the last one
+
+inline void markDirtyPixel(int x, int y){
+	if (x < dirtyPixelBox.x1) dirtyPixelBox.x1 = x;
+	if (x >= dirtyPixelBox.x2) dirtyPixelBox.x2 = x+1;
+	if (y < dirtyPixelBox.y1) dirtyPixelBox.y1 = y;
+	if (y >= dirtyPixelBox.y2) dirtyPixelBox.y2 = y+1;
+}
+
 #ifdef PC
 void line(int x1, int y1, int x2, int y2, uint16_t color);
 void triangle(int x0, int y0, int x1, int y1, int x2, int y2, uint16_t colorFill, uint16_t colorLine);
@@ -45,15 +75,8 @@ inline uint16_t color(uint8_t R, uint8_t G, uint8_t B){
 }
 inline void setPixel(int x,int y, uint32_t color){
 	if(x>=0 && x < width && y>=0 && y < height){
-		unsigned char pixels[4]; // { A, B, G, R }
-		//Convert 565 colors to RGBA
-		/*R*/ pixels[3] = (color >> 8) & 0b11111000;
-		/*G*/ pixels[2] = (color >> 3) & 0b11111100;
-		/*B*/ pixels[1] = (color << 3) & 0b11111000;
-		/*A*/ pixels[0] = 0;
-		SDL_Rect rect;
-		rect.x = x; rect.y = y; rect.w =1; rect.h = 1;
-		SDL_UpdateTexture(texture, &rect , (void*)pixels, 4);
+		vram[width*y + x] = (uint16_t)color;
+		markDirtyPixel(x, y);
 	}
 }
 
@@ -123,6 +146,7 @@ inline void setPixel(int x, int y, uint32_t color) {
     if(x>=0 && x < width && y>=0 && y < height) {
         // Use global vram pointer
         vram[width*y + x] = (uint16_t)color;
+        markDirtyPixel(x, y);
     }
 }
 
@@ -0,0 +1,166 @@
+// collision_masks.hpp, written by collision_masks.py from res/CPFlappyBird, don't edit
+// included by lib/collision/mask.hpp
+
+#pragma once
+
+// flappy0: 34x24
+constexpr uint64_t mask_flappy0_rows[] = {
+	0x000FFF0000000000ULL,
+	0x000FFF0000000000ULL,
+	0x00FFFFC000000000ULL,
+	0x00FFFFC000000000ULL,
+	0x03FFFFF000000000ULL,
+	0x03FFFFF000000000ULL,
+	0x0FFFFFFC00000000ULL,
+	0x0FFFFFFC00000000ULL,
+	0x3FFFFFFC00000000ULL,
+	0x3FFFFFFC00000000ULL,
+	0x3FFFFFFC00000000ULL,
+	0x3FFFFFFC00000000ULL,
+	0x3FFFFFFF00000000ULL,
+	0x3FFFFFFF00000000ULL,
+	0xFFFFFFFFC0000000ULL,
+	0xFFFFFFFFC0000000ULL,
+	0xFFFFFFFF00000000ULL,
+	0xFFFFFFFF00000000ULL,
+	0xFFFFFFFF00000000ULL,
+	0xFFFFFFFF00000000ULL,
+	0x3FFFFFFC00000000ULL,
+	0x3FFFFFFC00000000ULL,
+	0x003FF00000000000ULL,
+	0x003FF00000000000ULL,
+};
+constexpr CollisionMask mask_flappy0 = {34, 24, mask_flappy0_rows};
+
+// flappy1: 34x24
+constexpr uint64_t mask_flappy1_rows[] = {
+	0x000FFF0000000000ULL,
+	0x000FFF0000000000ULL,
+	0x00FFFFC000000000ULL,
+	0x00FFFFC000000000ULL,
+	0x03FFFFF000000000ULL,
+	0x03FFFFF000000000ULL,
+	0x0FFFFFFC00000000ULL,
+	0x0FFFFFFC00000000ULL,
+	0x3FFFFFFC00000000ULL,
+	0x3FFFFFFC00000000ULL,
+	0x3FFFFFFC00000000ULL,
+	0x3FFFFFFC00000000ULL,
+	0xFFFFFFFF00000000ULL,
+	0xFFFFFFFF00000000ULL,
+	0xFFFFFFFFC0000000ULL,
+	0xFFFFFFFFC0000000ULL,
+	0x3FFFFFFF00000000ULL,
+	0x3FFFFFFF00000000ULL,
+	0x0FFFFFFF00000000ULL,
+	0x0FFFFFFF00000000ULL,
+	0x03FFFFFC00000000ULL,
+	0x03FFFFFC00000000ULL,
+	0x003FF00000000000ULL,
+	0x003FF00000000000ULL,
+};
+constexpr CollisionMask mask_flappy1 = {34, 24, mask_flappy1_rows};
+
+// flappy2: 34x24
+constexpr uint64_t mask_flappy2_rows[] = {
+	0x000FFF0000000000ULL,
+	0x000FFF0000000000ULL,
+	0x00FFFFC000000000ULL,
+	0x00FFFFC000000000ULL,
+	0x03FFFFF000000000ULL,
+	0x03FFFFF000000000ULL,
+	0x3FFFFFFC00000000ULL,
+	0x3FFFFFFC00000000ULL,
+	0xFFFFFFFC00000000ULL,
+	0xFFFFFFFC00000000ULL,
+	0xFFFFFFFC00000000ULL,
+	0xFFFFFFFC00000000ULL,
+	0xFFFFFFFF00000000ULL,
+	0xFFFFFFFF00000000ULL,
+	0x3FFFFFFFC0000000ULL,
+	0x3FFFFFFFC0000000ULL,
+	0x0FFFFFFF00000000ULL,
+	0x0FFFFFFF00000000ULL,
+	0x0FFFFFFF00000000ULL,
+	0x0FFFFFFF00000000ULL,
+	0x03FFFFFC00000000ULL,
+	0x03FFFFFC00000000ULL,
+	0x003FF00000000000ULL,
+	0x003FF00000000000ULL,
+};
+constexpr CollisionMask mask_flappy2 = {34, 24, mask_flappy2_rows};
+
+// pipe0: 52x26
+constexpr uint64_t mask_pipe0_rows[] = {
+	0xFFFFFFFFFFFFF000ULL,
+	0xFFFFFFFFFFFFF000ULL,
+	0xFFFFFFFFFFFFF000ULL,
+	0xFFFFFFFFFFFFF000ULL,
+	0xFFFFFFFFFFFFF000ULL,
+	0xFFFFFFFFFFFFF000ULL,
+	0xFFFFFFFFFFFFF000ULL,
+	0xFFFFFFFFFFFFF000ULL,
+	0xFFFFFFFFFFFFF000ULL,
+	0xFFFFFFFFFFFFF000ULL,
+	0xFFFFFFFFFFFFF000ULL,
+	0xFFFFFFFFFFFFF000ULL,
+	0xFFFFFFFFFFFFF000ULL,
+	0xFFFFFFFFFFFFF000ULL,
+	0xFFFFFFFFFFFFF000ULL,
+	0xFFFFFFFFFFFFF000ULL,
+	0xFFFFFFFFFFFFF000ULL,
+	0xFFFFFFFFFFFFF000ULL,
+	0xFFFFFFFFFFFFF000ULL,
+	0xFFFFFFFFFFFFF000ULL,
+	0xFFFFFFFFFFFFF000ULL,
+	0xFFFFFFFFFFFFF000ULL,
+	0xFFFFFFFFFFFFF000ULL,
+	0xFFFFFFFFFFFFF000ULL,
+	0x3FFFFFFFFFFFC000ULL,
+	0x3FFFFFFFFFFFC000ULL,
+};
+constexpr CollisionMask mask_pipe0 = {52, 26, mask_pipe0_rows};
+
+// pipe0_body: 52x1
+constexpr uint64_t mask_pipe0_body_rows[] = {
+	0x3FFFFFFFFFFFC000ULL,
+};
+constexpr CollisionMask mask_pipe0_body = {52, 1, mask_pipe0_body_rows};
+
+// pipe1: 52x26
+constexpr uint64_t mask_pipe1_rows[] = {
+	0x3FFFFFFFFFFFC000ULL,
+	0x3FFFFFFFFFFFC000ULL,
+	0xFFFFFFFFFFFFF000ULL,
+	0xFFFFFFFFFFFFF000ULL,
+	0xFFFFFFFFFFFFF000ULL,
+	0xFFFFFFFFFFFFF000ULL,
+	0xFFFFFFFFFFFFF000ULL,
+	0xFFFFFFFFFFFFF000ULL,
+	0xFFFFFFFFFFFFF000ULL,
+	0xFFFFFFFFFFFFF000ULL,
+	0xFFFFFFFFFFFFF000ULL,
+	0xFFFFFFFFFFFFF000ULL,
+	0xFFFFFFFFFFFFF000ULL,
+	0xFFFFFFFFFFFFF000ULL,
+	0xFFFFFFFFFFFFF000ULL,
+	0xFFFFFFFFFFFFF000ULL,
+	0xFFFFFFFFFFFFF000ULL,
+	0xFFFFFFFFFFFFF000ULL,
+	0xFFFFFFFFFFFFF000ULL,
+	0xFFFFFFFFFFFFF000ULL,
+	0xFFFFFFFFFFFFF000ULL,
+	0xFFFFFFFFFFFFF000ULL,
+	0xFFFFFFFFFFFFF000ULL,
+	0xFFFFFFFFFFFFF000ULL,
+	0xFFFFFFFFFFFFF000ULL,
+	0xFFFFFFFFFFFFF000ULL,
+};
+constexpr CollisionMask mask_pipe1 = {52, 26, mask_pipe1_rows};
+
+// pipe1_body: 52x1
+constexpr uint64_t mask_pipe1_body_rows[] = {
+	0x3FFFFFFFFFFFC000ULL,
+};
+constexpr CollisionMask mask_pipe1_body = {52, 1, mask_pipe1_body_rows};
+
@@ -10,16 +10,20 @@
 #include <cstdlib>
 #include <cstring>
 #include "shaders.hpp"
+#include "fill_functions.hpp"
+#include "asset_pack.hpp"
+#include "arena.hpp"
+#include "texture_format.hpp"
 #include "calc.hpp"
 
-#define LOAD_TEXTURE_PTR(path, pointer) uint16_t *pointer = load_texture(path)
-#define LOAD_FONT_PTR(path, pointer) uint8_t *pointer = load_font(path)
-#define DRAW_TEXTURE(texturepointer, x, y) draw_texture_shader(texturepointer, x, y, 1, 0)
-#define DRAW_TEXTURE_FRAME(texturepointer, x, y, frame) draw_texture_shader(texturepointer, x, y, 2, frame)
-#define DRAW_FONT(fontpointer, text, x, y, color, wrapLength) draw_font_shader(fontpointer, text, x, y, color, wrapLength, 1, 0, 0)
+#define LOAD_TEXTURE_PTR(path, pointer) Texture *pointer = load_texture(path)
+#define LOAD_FONT_PTR(path, pointer) Font *pointer = load_font(path)
+#define DRAW_TEXTURE(texturepointer, x, y) draw_texture_shader<ShaderCutout>(texturepointer, x, y, 0)
+#define DRAW_TEXTURE_FRAME(texturepointer, x, y, frame) draw_texture_shader<ShaderFrame>(texturepointer, x, y, frame)
+#define DRAW_FONT(fontpointer, text, x, y, color, wrapLength) draw_font_shader<ShaderCutout>(fontpointer, text, x, y, color, wrapLength, 1, 0)
+#define DRAW_TEXT(layoutpointer, x, y, color) draw_text_layout<ShaderCutout>(layoutpointer, x, y, color, 0)
 
-// start with zero assets loaded
-uint16_t memUsed = 0;
+// start with zero assets loaded, they're all allocated from assetArena (see arena.hpp)
 uint16_t txLoaded = 0; //textures loaded
 uint16_t fLoaded = 0; //fonts loaded
 
@@ -27,7 +31,253 @@ inline uint16_t uint8to16(uint8_t highByte, uint8_t lowByte) {
 	return (highByte << 8) | lowByte;
 }
 
-uint16_t *load_texture(const char *texturepath) {
+// one run of opaque texels inside a texture row: starts "x" texels from the row start and is "len" texels long
+// everything between two runs is transparent and skipped by the blitter
+struct TextureSpan {
+	uint16_t x;
+	uint16_t len;
+};
+
+struct Texture {
+	uint16_t w;
+	uint16_t h;
+	uint8_t format; // TextureFormat, see texture_format.hpp
+	uint32_t stride; // bytes from one texel row to the next
+	const uint16_t *palette; // indexed formats only, entry 0 is TRANSPARENCY_COLOR
+	const uint8_t *texels; // rgb565 texels or palette indices row after row, the rle packets or the tiles
+	const uint32_t *rowOffsets; // rle only, row j is decoded from texels + rowOffsets[j]
+	const uint8_t *tileMap; // tiled only, which tile is drawn at each tile position
+	uint8_t tileShift; // tiled only, tiles are 1 << tileShift texels wide and high
+	uint8_t solidTiles; // tiled only, the first solidTiles tiles have a single colour
+	const uint32_t *rowSpans; // the runs of row j are spans[rowSpans[j]] up to spans[rowSpans[j+1]] (h+1 entries)
+	const TextureSpan *spans;
+	uint8_t *data; // the loaded file, 0 when it's in the asset pack or built into the binary
+};
+
+// how the blitters read each format, indexed texels are expanded through the palette while they're copied to the screen
+// Format::Row row = Format::row(tex, j) starts reading row j, Format::copy(row, dst, tex, i, len) expands len texels
+// starting at column i into dst, the runs of one row have to be copied from left to right
+struct FormatRGB565 {
+	typedef const uint16_t *Row;
+	static inline Row row(const Texture *tex, int j) { return (const uint16_t*)(tex->texels + j*tex->stride); }
+	static inline void copy(Row &row, uint16_t *dst, const Texture *, int i, int len) {
+		rgb565_copy(dst, row + i, len);
+	}
+};
+
+struct FormatIndexed8 {
+	typedef const uint8_t *Row;
+	static inline Row row(const Texture *tex, int j) { return tex->texels + j*tex->stride; }
+	static inline void copy(Row &row, uint16_t *dst, const Texture *tex, int i, int len) {
+		const uint8_t *src = row + i;
+		const uint16_t *palette = tex->palette;
+		for (int k = 0; k < len; k++) dst[k] = palette[src[k]];
+	}
+};
+
+struct FormatIndexed4 {
+	typedef const uint8_t *Row;
+	static inline Row row(const Texture *tex, int j) { return tex->texels + j*tex->stride; }
+	static inline void copy(Row &row, uint16_t *dst, const Texture *tex, int i, int len) {
+		const uint8_t *src = row + (i >> 1);
+		const uint16_t *palette = tex->palette;
+		if ((i & 1) && len > 0) {
+			*dst++ = palette[*src++ & 15];
+			len--;
+		}
+		for (; len >= 2; len -= 2) {
+			uint8_t pair = *src++;
+			dst[0] = palette[pair >> 4];
+			dst[1] = palette[pair & 15];
+			dst += 2;
+		}
+		if (len) *dst = palette[*src >> 4];
+	}
+};
+
+// the texture stays compressed in memory and is decoded while it's drawn, the row remembers the packet it got to,
+// so all the runs of a row walk its packets once, and repeated indices (like a row of sky) become a fill
+struct FormatRLE8 {
+	struct Row {
+		const uint8_t *packet;
+		int x; // column of the first texel of the packet
+	};
+	static inline Row row(const Texture *tex, int j) { return {tex->texels + tex->rowOffsets[j], 0}; }
+	static inline void copy(Row &row, uint16_t *dst, const Texture *tex, int i, int len) {
+		const uint16_t *palette = tex->palette;
+		while (len > 0) {
+			uint8_t c = *row.packet;
+			bool repeat = c >= 128;
+			int n = repeat ? c - 125 : c + 1;
+			if (row.x + n <= i) {
+				// the packet ends before column i
+				row.packet += repeat ? 2 : n + 1;
+				row.x += n;
+				continue;
+			}
+			int skip = i - row.x;
+			int take = n - skip < len ? n - skip : len;
+			if (repeat) {
+				rgb565_fill(dst, take, palette[row.packet[1]]);
+			} else {
+				const uint8_t *src = row.packet + 1 + skip;
+				for (int k = 0; k < take; k++) dst[k] = palette[src[k]];
+			}
+			dst += take;
+			i += take;
+			len -= take;
+		}
+	}
+};
+
+// a big picture that repeats itself (sky, buildings, ground) is stored once per different tile, the row keeps the tile row
+// of the map and the texel row inside the tiles, every tile a run crosses is one lookup and single colour tiles are a fill
+struct FormatTiled8 {
+	struct Row {
+		const uint8_t *map;
+		const uint8_t *tiles; // texel row j inside the first tile
+	};
+	static inline Row row(const Texture *tex, int j) {
+		int shift = tex->tileShift;
+		int columns = (tex->w + (1 << shift) - 1) >> shift;
+		return {tex->tileMap + (j >> shift)*columns, tex->texels + ((j & ((1 << shift) - 1)) << shift)};
+	}
+	static inline void copy(Row &row, uint16_t *dst, const Texture *tex, int i, int len) {
+		const uint16_t *palette = tex->palette;
+		int shift = tex->tileShift;
+		int mask = (1 << shift) - 1;
+		while (len > 0) {
+			int n = (mask + 1) - (i & mask);
+			if (n > len) n = len;
+			uint8_t tile = row.map[i >> shift];
+			const uint8_t *src = row.tiles + ((uint32_t)tile << (2*shift)) + (i & mask);
+			if (tile < tex->solidTiles) rgb565_fill(dst, n, palette[*src]);
+			else for (int k = 0; k < n; k++) dst[k] = palette[src[k]];
+			dst += n;
+			i += n;
+			len -= n;
+		}
+	}
+};
+
+// calls draw.template operator()<Format>() with the policy of the texture's format
+template <typename Draw>
+inline void texture_dispatch(const Texture *tex, Draw draw) {
+	switch (tex->format) {
+		case TEXTURE_INDEXED4: draw.template operator()<FormatIndexed4>(); break;
+		case TEXTURE_INDEXED8: draw.template operator()<FormatIndexed8>(); break;
+		case TEXTURE_RLE8: draw.template operator()<FormatRLE8>(); break;
+		case TEXTURE_TILED8: draw.template operator()<FormatTiled8>(); break;
+		default: draw.template operator()<FormatRGB565>(); break;
+	}
+}
+
+// expands one row into rgb565, only used while building the lookup tables
+inline void texture_row(const Texture *tex, int j, uint16_t *out) {
+	texture_dispatch(tex, [&]<typename Format>() {
+		typename Format::Row row = Format::row(tex, j);
+		Format::copy(row, out, tex, 0, tex->w);
+	});
+}
+
+// counts the opaque runs of a row, and stores them when spans isn't 0
+uint32_t texture_row_spans(const uint16_t *row, uint16_t w, TextureSpan *spans) {
+	uint32_t count = 0;
+	uint16_t i = 0;
+	while (i < w) {
+		while (i < w && row[i] == TRANSPARENCY_COLOR) i++;
+		uint16_t runStart = i;
+		while (i < w && row[i] != TRANSPARENCY_COLOR) i++;
+		if (i > runStart) {
+			if (spans) {
+				spans[count].x = runStart;
+				spans[count].len = i - runStart;
+			}
+			count++;
+		}
+	}
+	return count;
+}
+
+// decode the transparency of a loaded texture file once into opaque runs, so the blitters never look at TRANSPARENCY_COLOR again
+// the palette and texels have to be in the host byte order already, and all of the info.size bytes of the file have to be there
+// a file that would make the blitters read outside of it is rejected (see texture_file_check)
+Texture *texture_build_spans(uint8_t *data) {
+	TextureFileInfo info;
+	if (!texture_file_info(data, &info) || !texture_file_check(data, &info)) return 0;
+	const uint16_t *palette = info.colors ? (const uint16_t*)(data + info.paletteOffset) : 0;
+	const uint32_t *rowOffsets = info.rowOffset ? (const uint32_t*)(data + info.rowOffset) : 0;
+	const uint8_t *tileMap = info.mapOffset ? data + info.mapOffset : 0;
+	Texture view = {info.w, info.h, info.format, info.stride, palette, data + info.texelOffset, rowOffsets, tileMap, info.tileShift, info.solidTiles, 0, 0, data};
+	// the row buffer sits at the end of the arena, it's released before the texture takes its place and taken again after it
+	ArenaMark mark = arena_mark(&assetArena);
+	uint16_t *row = (uint16_t*)arena_alloc(&assetArena, info.w*2 + 2);
+	if (!row) return 0;
+	uint32_t spanCount = 0;
+	for (uint16_t j = 0; j < info.h; j++) {
+		texture_row(&view, j, row);
+		spanCount += texture_row_spans(row, info.w, 0);
+	}
+	arena_release(&assetArena, mark);
+	uint32_t size = sizeof(Texture) + (info.h+1)*sizeof(uint32_t) + spanCount*sizeof(TextureSpan);
+	Texture *tex = (Texture*)arena_alloc(&assetArena, size);
+	if (!tex) return 0;
+	mark = arena_mark(&assetArena);
+	row = (uint16_t*)arena_alloc(&assetArena, info.w*2 + 2);
+	if (!row) {
+		arena_release(&assetArena, mark);
+		return 0;
+	}
+	*tex = view;
+	uint32_t *rowSpans = (uint32_t*)(tex + 1);
+	TextureSpan *spans = (TextureSpan*)(rowSpans + info.h + 1);
+	tex->rowSpans = rowSpans;
+	tex->spans = spans;
+	uint32_t s = 0;
+	for (uint16_t j = 0; j < info.h; j++) {
+		rowSpans[j] = s;
+		texture_row(tex, j, row);
+		s += texture_row_spans(row, info.w, spans + s);
+	}
+	rowSpans[info.h] = s;
+	arena_release(&assetArena, mark);
+	return tex;
+}
+
+// with EMBEDDED_ASSETS the converted assets are built into the binary (see embed_assets.py) and loading one only looks it up,
+// nothing is read or allocated, names that aren't built in still come from the asset pack or the loose files
+#ifdef EMBEDDED_ASSETS
+	struct Font;
+	struct EmbeddedAsset {
+		const char *name; // as in the asset pack, fonts start with "fnt/"
+		Texture *texture;
+		Font *font;
+	};
+	const EmbeddedAsset *find_embedded_asset(const char *name);
+#endif
+
+// the texture and its file (when it isn't in the pack) stay in the arena until the scope they were loaded in is released
+Texture *load_texture(const char *texturepath) {
+	#ifdef EMBEDDED_ASSETS
+		const EmbeddedAsset *embedded = find_embedded_asset(texturepath);
+		if (embedded && embedded->texture) {
+			txLoaded += 1;
+			return embedded->texture;
+		}
+	#endif
+	ArenaMark mark = arena_mark(&assetArena);
+	arena_label(&assetArena, texturepath);
+	uint8_t *packed = find_asset(texturepath, 'T', 0);
+	if (packed) {
+		Texture *tex = texture_build_spans(packed);
+		if (!tex) {
+			arena_release(&assetArena, mark);
+			return 0;
+		}
+		tex->data = 0;
+		txLoaded += 1;
+		return tex;
+	}
 	char concatpath[128];
 	#ifdef PATH_PREFIX
 		strcpy(concatpath, PATH_PREFIX);
@@ -37,34 +287,450 @@ uint16_t *load_texture(const char *texturepath) {
 	strcat(concatpath, texturepath);
 	FILE *fd = fopen(concatpath, "rb");
 	if (fd) {
-		uint16_t info[2];
-		fread(info, 1, 4, fd);
-		uint16_t w = info[0];
-		uint16_t h = info[1];
-		uint16_t *result = (uint16_t*)malloc(w*h*2+4);
-		memUsed += (w*h*2)+4;
-		txLoaded += 1;
+		uint8_t header[TEXTURE_HEADER_PEEK] = {0};
+		fread(header, 1, TEXTURE_HEADER_PEEK, fd);
+		TextureFileInfo info;
+		uint8_t *result = texture_file_info(header, &info) ? (uint8_t*)arena_alloc(&assetArena, info.size) : 0;
+		if (!result) {
+			fclose(fd);
+			arena_release(&assetArena, mark);
+			return 0;
+		}
 		fseek(fd, 0, SEEK_SET);
-		fread(result, 1, w*h*2+4, fd);
+		bool complete = fread(result, 1, info.size, fd) == info.size;
 		fclose(fd);
-		return result;
+		// a file shorter than its header says isn't decoded from whatever was in the arena before
+		if (!complete) {
+			arena_release(&assetArena, mark);
+			return 0;
+		}
+		// the files are big endian like the calculator, a little endian host (the pc build) swaps them after reading
+		#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+			texture_file_swap(result);
+		#endif
+		Texture *tex = texture_build_spans(result);
+		if (!tex) {
+			arena_release(&assetArena, mark);
+			return 0;
+		}
+		txLoaded += 1;
+		return tex;
 	}
+	arena_release(&assetArena, mark);
 	return 0;
 }
 
-void draw_texture_shader(uint16_t *texturepointer, int16_t x, int16_t y, uint16_t shaderID, int shaderArg) {
-	uint16_t w = texturepointer[0];
-	uint16_t h = texturepointer[1];
-	int k = 2;
-	for (int16_t j = 0; j < h; j++) {
-		for (int16_t i = 0; i < w; i++) {
-			shader(x, y, w, h, i, j, texturepointer[k], shaderID, shaderArg);
-			k++;
+// copy the opaque runs of the texture rows firstRow..firstRow+rowCount-1 to the screen, with the top-left corner at x, y
+// the texture is clipped against the screen once per row and whole runs are copied into vram
+template <typename Format>
+void blit_texture_rows(Texture *tex, int x, int y, int firstRow, int rowCount) {
+	int jStart = y < 0 ? -y : 0;
+	int jEnd = y + rowCount > height ? height - y : rowCount;
+	int iMin = x < 0 ? -x : 0; // first visible column in texture space
+	int iMax = x + tex->w > width ? width - x : tex->w; // one past the last visible column
+	if (jStart >= jEnd || iMin >= iMax) return;
+	markDirty(x + iMin, y + jStart, iMax - iMin, jEnd - jStart);
+	for (int j = jStart; j < jEnd; j++) {
+		int row = firstRow + j;
+		uint16_t *dst = vram + (y+j)*width + x;
+		typename Format::Row src = Format::row(tex, row);
+		for (uint32_t s = tex->rowSpans[row]; s < tex->rowSpans[row+1]; s++) {
+			int a = tex->spans[s].x;
+			int b = a + tex->spans[s].len;
+			if (a < iMin) a = iMin;
+			if (b > iMax) b = iMax;
+			if (a < b) Format::copy(src, dst + a, tex, a, b-a);
+		}
+	}
+}
+
+void blit_texture_rows(Texture *tex, int x, int y, int firstRow, int rowCount) {
+	texture_dispatch(tex, [&]<typename Format>() { blit_texture_rows<Format>(tex, x, y, firstRow, rowCount); });
+}
+
+// what changes on screen when a texture that was drawn at x+1 is drawn again at x (scrolled one pixel to the left)
+// "draw" runs are the texels that differ from their left neighbour (which is what the screen shows there now),
+// "restore" runs are the columns the texture moved away from, where the background shows again (these can reach column w)
+struct TextureScroll {
+	uint32_t *rowDraw; // the draw runs of row j are draw[rowDraw[j]] up to draw[rowDraw[j+1]]
+	TextureSpan *draw;
+	uint32_t *rowRestore;
+	TextureSpan *restore;
+};
+
+// 0 = unchanged, 1 = draw the texel, 2 = restore the background
+inline uint8_t scroll_action(uint16_t *row, uint16_t w, uint16_t i) {
+	bool nowOpaque = i < w && row[i] != TRANSPARENCY_COLOR;
+	bool wasOpaque = i > 0 && row[i-1] != TRANSPARENCY_COLOR;
+	if (nowOpaque) return (wasOpaque && row[i] == row[i-1]) ? 0 : 1;
+	return wasOpaque ? 2 : 0;
+}
+
+// appends the runs of one action in a row to spans (or only counts them if spans is 0)
+uint32_t scroll_runs(uint16_t *row, uint16_t w, uint8_t action, TextureSpan *spans) {
+	uint32_t count = 0;
+	uint16_t i = 0;
+	while (i <= w) {
+		while (i <= w && scroll_action(row, w, i) != action) i++;
+		uint16_t runStart = i;
+		while (i <= w && scroll_action(row, w, i) == action) i++;
+		if (i > runStart) {
+			if (spans) {
+				spans[count].x = runStart;
+				spans[count].len = i - runStart;
+			}
+			count++;
+		}
+	}
+	return count;
+}
+
+TextureScroll *texture_build_scroll(Texture *tex) {
+	ArenaMark mark = arena_mark(&assetArena);
+	uint16_t *row = (uint16_t*)arena_alloc(&assetArena, tex->w*2 + 2);
+	if (!row) return 0;
+	uint32_t drawCount = 0;
+	uint32_t restoreCount = 0;
+	for (uint16_t j = 0; j < tex->h; j++) {
+		texture_row(tex, j, row);
+		drawCount += scroll_runs(row, tex->w, 1, 0);
+		restoreCount += scroll_runs(row, tex->w, 2, 0);
+	}
+	arena_release(&assetArena, mark);
+	uint32_t size = sizeof(TextureScroll) + 2*(tex->h+1)*sizeof(uint32_t) + (drawCount+restoreCount)*sizeof(TextureSpan);
+	TextureScroll *scroll = (TextureScroll*)arena_alloc(&assetArena, size);
+	if (!scroll) return 0;
+	ArenaMark rowMark = arena_mark(&assetArena);
+	row = (uint16_t*)arena_alloc(&assetArena, tex->w*2 + 2);
+	if (!row) {
+		// the tables are no use without the row to fill them
+		arena_release(&assetArena, mark);
+		return 0;
+	}
+	scroll->rowDraw = (uint32_t*)(scroll + 1);
+	scroll->rowRestore = scroll->rowDraw + tex->h + 1;
+	scroll->draw = (TextureSpan*)(scroll->rowRestore + tex->h + 1);
+	scroll->restore = scroll->draw + drawCount;
+	uint32_t d = 0;
+	uint32_t r = 0;
+	for (uint16_t j = 0; j < tex->h; j++) {
+		scroll->rowDraw[j] = d;
+		scroll->rowRestore[j] = r;
+		texture_row(tex, j, row);
+		d += scroll_runs(row, tex->w, 1, scroll->draw + d);
+		r += scroll_runs(row, tex->w, 2, scroll->restore + r);
+	}
+	scroll->rowDraw[tex->h] = d;
+	scroll->rowRestore[tex->h] = r;
+	arena_release(&assetArena, rowMark);
+	return scroll;
+}
+
+// copy the w x h rectangle at x, y of a full screen background (drawn at 0, 0) back to the screen
+// clipped once against the screen and the background, then copied row by row with the background's own stride
+// this doesn't mark the area dirty, the caller covers it (see restore_rect)
+inline void copy_background_rect(Texture *bg, int x, int y, int w, int h) {
+	int right = x + w;
+	int bottom = y + h;
+	if (x < 0) x = 0;
+	if (y < 0) y = 0;
+	if (right > width) right = width;
+	if (right > bg->w) right = bg->w;
+	if (bottom > height) bottom = height;
+	if (bottom > bg->h) bottom = bg->h;
+	if (x >= right || y >= bottom) return;
+	texture_dispatch(bg, [&]<typename Format>() {
+		uint16_t *dst = vram + y*width + x;
+		for (int j = y; j < bottom; j++, dst += width) {
+			typename Format::Row src = Format::row(bg, j);
+			Format::copy(src, dst, bg, x, right - x);
+		}
+	});
+}
+
+void restore_rect(Texture *bg, int x, int y, int w, int h) {
+	copy_background_rect(bg, x, y, w, h);
+	markDirty(x, y, w, h);
+}
+
+// redraw a texture that was drawn at x+1, y last time at x, y, writing only the pixels that change
+// bg is the full screen background (drawn at 0, 0) that shows again where the texture moved away
+template <typename Format>
+void blit_texture_scroll(Texture *tex, TextureScroll *scroll, int x, int y, Texture *bg) {
+	int jStart = y < 0 ? -y : 0;
+	int jEnd = y + tex->h > height ? height - y : tex->h;
+	int iMin = x < 0 ? -x : 0;
+	int iMax = x + tex->w > width ? width - x : tex->w;
+	markDirty(x, y, tex->w + 1, tex->h); // the column the texture moved away from is restored too
+	for (int j = jStart; j < jEnd; j++) {
+		uint16_t *dst = vram + (y+j)*width + x;
+		typename Format::Row src = Format::row(tex, j);
+		for (uint32_t s = scroll->rowDraw[j]; s < scroll->rowDraw[j+1]; s++) {
+			int a = scroll->draw[s].x;
+			int b = a + scroll->draw[s].len;
+			if (a < iMin) a = iMin;
+			if (b > iMax) b = iMax;
+			if (a < b) Format::copy(src, dst + a, tex, a, b-a);
+		}
+		for (uint32_t s = scroll->rowRestore[j]; s < scroll->rowRestore[j+1]; s++) {
+			copy_background_rect(bg, x + scroll->restore[s].x, y + j, scroll->restore[s].len, 1);
+		}
+	}
+}
+
+void blit_texture_scroll(Texture *tex, TextureScroll *scroll, int x, int y, Texture *bg) {
+	texture_dispatch(tex, [&]<typename Format>() { blit_texture_scroll<Format>(tex, scroll, x, y, bg); });
+}
+
+// one texture row that is drawn over and over below itself (the body of a pipe), expanded to rgb565 once
+// so every row it fills is a plain copy of the opaque runs, the scroll runs are the same as a TextureScroll row
+struct TextureLine {
+	uint16_t w;
+	uint16_t *pixels;
+	uint16_t spanCount;
+	TextureSpan *spans;
+	uint16_t drawCount;
+	TextureSpan *draw;
+	uint16_t restoreCount;
+	TextureSpan *restore;
+};
+
+// the rgb565 row is decoded straight into the line, the runs are only counted on it once it's there
+TextureLine *texture_build_line(Texture *tex, int j) {
+	ArenaMark mark = arena_mark(&assetArena);
+	uint16_t *row = (uint16_t*)arena_alloc(&assetArena, tex->w*2 + 2);
+	if (!row) return 0;
+	texture_row(tex, j, row);
+	uint16_t spanCount = texture_row_spans(row, tex->w, 0);
+	uint16_t drawCount = scroll_runs(row, tex->w, 1, 0);
+	uint16_t restoreCount = scroll_runs(row, tex->w, 2, 0);
+	arena_release(&assetArena, mark);
+	uint32_t size = sizeof(TextureLine) + tex->w*2 + (spanCount+drawCount+restoreCount)*sizeof(TextureSpan);
+	TextureLine *line = (TextureLine*)arena_alloc(&assetArena, size);
+	if (!line) return 0;
+	line->w = tex->w;
+	line->pixels = (uint16_t*)(line + 1);
+	line->spans = (TextureSpan*)(line->pixels + tex->w);
+	line->draw = line->spans + spanCount;
+	line->restore = line->draw + drawCount;
+	texture_row(tex, j, line->pixels);
+	line->spanCount = texture_row_spans(line->pixels, tex->w, line->spans);
+	line->drawCount = scroll_runs(line->pixels, tex->w, 1, line->draw);
+	line->restoreCount = scroll_runs(line->pixels, tex->w, 2, line->restore);
+	return line;
+}
+
+// clips the line drawn on count rows from x, y against the screen, false when none of the rows are visible
+inline bool clip_texture_line(TextureLine *line, int x, int y, int count, int *jStart, int *jEnd, int *iMin, int *iMax) {
+	*jStart = y < 0 ? -y : 0;
+	*jEnd = y + count > height ? height - y : count;
+	*iMin = x < 0 ? -x : 0;
+	*iMax = x + line->w > width ? width - x : line->w;
+	return *jStart < *jEnd;
+}
+
+// draws the line on count rows starting at x, y
+void draw_texture_line(TextureLine *line, int x, int y, int count) {
+	int jStart, jEnd, iMin, iMax;
+	if (!clip_texture_line(line, x, y, count, &jStart, &jEnd, &iMin, &iMax) || iMin >= iMax) return;
+	markDirty(x + iMin, y + jStart, iMax - iMin, jEnd - jStart);
+	uint16_t *dst = vram + (y+jStart)*width + x;
+	for (int j = jStart; j < jEnd; j++, dst += width) {
+		for (uint16_t s = 0; s < line->spanCount; s++) {
+			int a = line->spans[s].x;
+			int b = a + line->spans[s].len;
+			if (a < iMin) a = iMin;
+			if (b > iMax) b = iMax;
+			if (a < b) rgb565_copy(dst + a, line->pixels + a, b-a);
+		}
+	}
+}
+
+// the line version of blit_texture_scroll, the restored columns are the same on every row so each is one background rectangle
+void blit_texture_line_scroll(TextureLine *line, int x, int y, int count, Texture *bg) {
+	int jStart, jEnd, iMin, iMax;
+	if (!clip_texture_line(line, x, y, count, &jStart, &jEnd, &iMin, &iMax)) return;
+	markDirty(x, y + jStart, line->w + 1, jEnd - jStart);
+	uint16_t *dst = vram + (y+jStart)*width + x;
+	for (int j = jStart; j < jEnd; j++, dst += width) {
+		for (uint16_t s = 0; s < line->drawCount; s++) {
+			int a = line->draw[s].x;
+			int b = a + line->draw[s].len;
+			if (a < iMin) a = iMin;
+			if (b > iMax) b = iMax;
+			if (a < b) rgb565_copy(dst + a, line->pixels + a, b-a);
+		}
+	}
+	for (uint16_t s = 0; s < line->restoreCount; s++) {
+		copy_background_rect(bg, x + line->restore[s].x, y + jStart, line->restore[s].len, jEnd - jStart);
+	}
+}
+
+// cutout shaders are handled by the span blitter, every other shader gets its own per-texel loop
+template <typename Shader>
+void draw_texture_shader(Texture *tex, int16_t x, int16_t y, int shaderArg) {
+	uint16_t w = tex->w;
+	uint16_t h = tex->h;
+	if constexpr (Shader::cutout) {
+		int first, count;
+		Shader::rowRange(w, h, shaderArg, &first, &count);
+		if (count > 0) blit_texture_rows(tex, x, y, first, count);
+	} else {
+		ArenaMark mark = arena_mark(&assetArena);
+		uint16_t *row = (uint16_t*)arena_alloc(&assetArena, w*2);
+		if (!row) return;
+		for (int16_t j = 0; j < h; j++) {
+			texture_row(tex, j, row);
+			for (int16_t i = 0; i < w; i++) {
+				Shader::plot(x, y, w, h, i, j, row[i], shaderArg);
+			}
+		}
+		arena_release(&assetArena, mark);
+	}
+}
+
+void draw_texture_shader(Texture *tex, int16_t x, int16_t y, uint16_t shaderID, int shaderArg) {
+	shader_dispatch(shaderID, [&]<typename Shader>() { draw_texture_shader<Shader>(tex, x, y, shaderArg); });
+}
+
+// fully specialised variant for sprites with a size known at compile time (the 34x24 bird frames, the 52x26 pipe caps)
+// when the sprite is completely on screen the clipping is skipped and every loop bound and row stride is a constant
+template <uint16_t W, uint16_t H, typename Shader = ShaderCutout>
+void draw_texture_fixed(Texture *tex, int16_t x, int16_t y, int shaderArg = 0) {
+	if (tex->w != W || tex->h != H) {
+		// a modded texture with another size
+		draw_texture_shader<Shader>(tex, x, y, shaderArg);
+		return;
+	}
+	if constexpr (Shader::cutout) {
+		int first, count;
+		Shader::rowRange(W, H, shaderArg, &first, &count);
+		if (count <= 0) return;
+		if (x < 0 || y < 0 || x + W > width || y + count > height) {
+			blit_texture_rows(tex, x, y, first, count);
+			return;
+		}
+		markDirty(x, y, W, count);
+		texture_dispatch(tex, [&]<typename Format>() {
+			uint16_t *dst = vram + y*width + x;
+			for (int row = first; row < first + count; row++) {
+				typename Format::Row src = Format::row(tex, row);
+				for (uint32_t s = tex->rowSpans[row]; s < tex->rowSpans[row+1]; s++) {
+					Format::copy(src, dst + tex->spans[s].x, tex, tex->spans[s].x, tex->spans[s].len);
+				}
+				dst += width;
+			}
+		});
+	} else {
+		uint16_t row[W];
+		for (int16_t j = 0; j < H; j++) {
+			texture_row(tex, j, row);
+			for (int16_t i = 0; i < W; i++) {
+				Shader::plot(x, y, W, H, i, j, row[i], shaderArg);
+			}
+		}
+	}
+}
+
+// one run of lit pixels inside a glyph row
+struct GlyphRun {
+	uint8_t x;
+	uint8_t len;
+};
+
+// glyph cache built from the 1-bit font file, covering the 95 printable characters from 32 to 126
+struct Font {
+	uint16_t w;
+	uint16_t h;
+	const uint16_t *rowRuns; // the runs of row r of glyph g are runs[rowRuns[g*h+r]] up to runs[rowRuns[g*h+r+1]] (95*h+1 entries)
+	const GlyphRun *runs;
+};
+
+#define FONT_GLYPHS 95
+
+#ifdef EMBEDDED_ASSETS
+	#include "embedded_assets.hpp"
+
+	const EmbeddedAsset *find_embedded_asset(const char *name) {
+		for (uint16_t k = 0; k < embeddedAssetCount; k++) {
+			if (strcmp(embeddedAssets[k].name, name) == 0) return &embeddedAssets[k];
+		}
+		return 0;
+	}
+#endif
+
+// fontdata is the font file: 4 byte header and then the glyphs as one continuous bit stream, w*h bits per glyph
+inline bool font_bit(uint8_t *fontdata, uint32_t bit) {
+	return fontdata[4 + bit/8] & (128 >> (bit%8));
+}
+
+// count (runs == 0) or write the runs of one glyph row
+uint16_t font_row_runs(uint8_t *fontdata, uint16_t w, uint32_t firstBit, GlyphRun *runs) {
+	uint16_t count = 0;
+	uint16_t i = 0;
+	while (i < w) {
+		while (i < w && !font_bit(fontdata, firstBit + i)) i++;
+		uint16_t runStart = i;
+		while (i < w && font_bit(fontdata, firstBit + i)) i++;
+		if (i > runStart) {
+			if (runs) {
+				runs[count].x = runStart;
+				runs[count].len = i - runStart;
+			}
+			count++;
 		}
 	}
+	return count;
 }
 
-uint8_t *load_font(const char *fontpath) {
+Font *font_build_cache(uint8_t *fontdata) {
+	uint16_t w = uint8to16(fontdata[0], fontdata[1]);
+	uint16_t h = uint8to16(fontdata[2], fontdata[3]);
+	uint32_t rows = FONT_GLYPHS*h;
+	uint32_t runCount = 0;
+	for (uint32_t r = 0; r < rows; r++) {
+		runCount += font_row_runs(fontdata, w, r*w, 0);
+	}
+	uint32_t size = sizeof(Font) + (rows+1)*sizeof(uint16_t) + runCount*sizeof(GlyphRun);
+	Font *font = (Font*)arena_alloc(&assetArena, size);
+	if (!font) return 0;
+	font->w = w;
+	font->h = h;
+	uint16_t *rowRuns = (uint16_t*)(font + 1);
+	GlyphRun *runs = (GlyphRun*)(rowRuns + rows + 1);
+	font->rowRuns = rowRuns;
+	font->runs = runs;
+	uint16_t k = 0;
+	for (uint32_t r = 0; r < rows; r++) {
+		rowRuns[r] = k;
+		k += font_row_runs(fontdata, w, r*w, runs + k);
+	}
+	rowRuns[rows] = k;
+	return font;
+}
+
+Font *load_font(const char *fontpath) {
+	char packname[32] = "fnt/";
+	strncat(packname, fontpath, sizeof(packname) - 5);
+	#ifdef EMBEDDED_ASSETS
+		const EmbeddedAsset *embedded = find_embedded_asset(packname);
+		if (embedded && embedded->font) {
+			fLoaded += 1;
+			return embedded->font;
+		}
+	#endif
+	ArenaMark mark = arena_mark(&assetArena);
+	arena_label(&assetArena, packname);
+	uint8_t *packed = find_asset(packname, 'F', 0);
+	if (packed) {
+		Font *font = font_build_cache(packed);
+		if (!font) {
+			arena_release(&assetArena, mark);
+			return 0;
+		}
+		fLoaded += 1;
+		return font;
+	}
 	char concatpath[128];
 	#ifdef FONT_PREFIX
 		strcpy(concatpath, FONT_PREFIX);
@@ -74,50 +740,147 @@ uint8_t *load_font(const char *fontpath) {
 	strcat(concatpath, fontpath);
 	FILE *fd = fopen(concatpath, "rb");
 	if (fd) {
-		uint16_t info[4];
-		fread(info, 1, 4, fd);
-		uint16_t w = info[0];
-		uint16_t h = info[1];
-		uint8_t *result = (uint8_t*)malloc(95*w*h/8+5);
-		memUsed += (95*w*h/8)+5;
-		fLoaded += 1;
-		fseek(fd, 0, SEEK_SET);
-		fread(result, 1, (95*w*h/8)+5, fd);
+		uint8_t info[4] = {0};
+		bool complete = fread(info, 1, 4, fd) == 4;
+		uint16_t w = uint8to16(info[0], info[1]);
+		uint16_t h = uint8to16(info[2], info[3]);
+		uint32_t size = 95*w*h/8+5;
+		// the file (less than a kilobyte) stays below the glyph cache in the arena, only the cache is used after this
+		uint8_t *result = complete ? (uint8_t*)arena_alloc(&assetArena, size) : 0;
+		if (result) {
+			fseek(fd, 0, SEEK_SET);
+			complete = fread(result, 1, size, fd) == size;
+		}
 		fclose(fd);
-		return result;
+		Font *font = result && complete ? font_build_cache(result) : 0;
+		if (!font) {
+			arena_release(&assetArena, mark);
+			return 0;
+		}
+		fLoaded += 1;
+		return font;
 	}
+	arena_release(&assetArena, mark);
 	return 0;
 }
 
 #define CHAR_SPACING 1
-void draw_font_shader(uint8_t *fontpointer, const char *text, int16_t x, int16_t y, uint16_t color, uint16_t wrapLength, int16_t lineSpacing, uint16_t shaderID, int shaderArg) {
-	uint16_t w = uint8to16(fontpointer[0], fontpointer[1]);
-	uint16_t h = uint8to16(fontpointer[2], fontpointer[3]);
+
+// a glyph placed by the text layout, dx and dy are relative to the text origin
+struct TextGlyph {
+	uint8_t glyph;
+	int16_t dx;
+	int16_t dy;
+};
+
+// the positions of every visible glyph of a string, computed once and drawn as often as needed
+struct TextLayout {
+	Font *font;
+	uint16_t wrapLength;
+	int16_t lineSpacing;
+	uint16_t count;
+	uint16_t capacity;
+	TextGlyph *glyphs;
+};
+
+// walks the text like the renderer always did (newlines, wrapping) and calls place(glyph, dx, dy) for each visible glyph
+template <typename Place>
+inline void font_layout(Font *font, const char *text, uint16_t wrapLength, int16_t lineSpacing, Place place) {
+	uint16_t w = font->w;
+	uint16_t h = font->h;
 	uint16_t newlines = 0;
 	uint16_t chars_since_newline = 0;
-	for (uint16_t textchar = 0; textchar < strlen(text); textchar++) { // repeat for each character in text
-		if (text[textchar] == 10) {
+	for (const char *c = text; *c; c++) { // repeat for each character in text
+		if (*c == 10) {
 			newlines++;
 			chars_since_newline = 0;
-		} else if (text[textchar] >= 32 && text[textchar] <= 126) {
+		} else if (*c >= 32 && *c <= 126) {
 			if (wrapLength > 0 && (w+CHAR_SPACING)*(chars_since_newline+1) > wrapLength) {
 				newlines++;
 				chars_since_newline = 0;
 			}
-			int current_byte = (text[textchar]-32)*w*h/8 + 4;
-			uint8_t current_bit = 128 >> (((text[textchar]-32)*w*h)%8);
-			for (int charbit = 0; charbit < w*h; charbit++) { // read bits of the target font character and draw pixels
-				if (fontpointer[current_byte] & current_bit) {
-					shader(x, y, w, h, charbit % w + (w+CHAR_SPACING)*chars_since_newline, charbit / w + (h+lineSpacing)*newlines, color, shaderID, shaderArg);
-				}
-				current_bit >>= 1;
-				if (current_bit < 1) {
-					current_bit = 128;
-					current_byte++;
-				}
+			uint8_t glyph = *c - 32;
+			// glyphs without lit pixels (space) take up room but are never drawn
+			if (font->rowRuns[glyph*h] != font->rowRuns[(glyph+1)*h]) {
+				place(glyph, (w+CHAR_SPACING)*chars_since_newline, (h+lineSpacing)*newlines);
 			}
 			chars_since_newline++;
 		}
+	}
+}
 
+// lays text out again, keeping the glyphs of the layout when the new text fits
+// longer text gets new glyphs from the arena, the old ones stay there until the layout's scope is released
+void relayout_text(TextLayout *layout, const char *text) {
+	uint16_t count = 0;
+	font_layout(layout->font, text, layout->wrapLength, layout->lineSpacing, [&](uint8_t, int16_t, int16_t) { count++; });
+	if (count > layout->capacity) {
+		layout->glyphs = (TextGlyph*)arena_alloc(&assetArena, count*sizeof(TextGlyph));
+		layout->capacity = layout->glyphs ? count : 0;
 	}
+	layout->count = 0;
+	font_layout(layout->font, text, layout->wrapLength, layout->lineSpacing, [&](uint8_t glyph, int16_t dx, int16_t dy) {
+		if (layout->count < layout->capacity) layout->glyphs[layout->count++] = {glyph, dx, dy};
+	});
+}
+
+TextLayout *layout_text(Font *font, const char *text, uint16_t wrapLength, int16_t lineSpacing) {
+	TextLayout *layout = (TextLayout*)arena_alloc(&assetArena, sizeof(TextLayout));
+	if (!layout) return 0;
+	*layout = {font, wrapLength, lineSpacing, 0, 0, 0};
+	relayout_text(layout, text);
+	return layout;
+}
+
+// draws one glyph at (x+dx, y+dy), solid shaders write the runs straight into vram
+template <typename Shader>
+inline void draw_glyph(Font *font, uint8_t glyph, int16_t x, int16_t y, int16_t dx, int16_t dy, uint16_t color, int shaderArg) {
+	uint16_t w = font->w;
+	uint16_t h = font->h;
+	const uint16_t *rowRuns = font->rowRuns + glyph*h;
+	if constexpr (Shader::solid) {
+		if (Shader::cutout && color == TRANSPARENCY_COLOR) return;
+		int gx = x + dx;
+		int gy = y + dy;
+		markDirty(gx, gy, w, h);
+		for (int r = 0; r < h; r++) {
+			if (gy + r < 0 || gy + r >= height) continue;
+			uint16_t *dst = vram + (gy+r)*width;
+			for (uint16_t k = rowRuns[r]; k < rowRuns[r+1]; k++) {
+				int a = gx + font->runs[k].x;
+				int b = a + font->runs[k].len;
+				if (a < 0) a = 0;
+				if (b > width) b = width;
+				if (a < b) rgb565_fill(dst + a, b-a, color);
+			}
+		}
+	} else {
+		for (int r = 0; r < h; r++) {
+			for (uint16_t k = rowRuns[r]; k < rowRuns[r+1]; k++) {
+				for (int i = font->runs[k].x; i < font->runs[k].x + font->runs[k].len; i++) {
+					Shader::plot(x, y, w, h, i + dx, r + dy, color, shaderArg);
+				}
+			}
+		}
+	}
+}
+
+template <typename Shader>
+void draw_text_layout(TextLayout *layout, int16_t x, int16_t y, uint16_t color, int shaderArg) {
+	for (uint16_t g = 0; g < layout->count; g++) {
+		TextGlyph *glyph = &layout->glyphs[g];
+		draw_glyph<Shader>(layout->font, glyph->glyph, x, y, glyph->dx, glyph->dy, color, shaderArg);
+	}
+}
+
+// immediate mode, for text that changes every time it's drawn (use a TextLayout otherwise)
+template <typename Shader>
+void draw_font_shader(Font *font, const char *text, int16_t x, int16_t y, uint16_t color, uint16_t wrapLength, int16_t lineSpacing, int shaderArg) {
+	font_layout(font, text, wrapLength, lineSpacing, [&](uint8_t glyph, int16_t dx, int16_t dy) {
+		draw_glyph<Shader>(font, glyph, x, y, dx, dy, color, shaderArg);
+	});
+}
+
+void draw_font_shader(Font *font, const char *text, int16_t x, int16_t y, uint16_t color, uint16_t wrapLength, int16_t lineSpacing, uint16_t shaderID, int shaderArg) {
+	shader_dispatch(shaderID, [&]<typename Shader>() { draw_font_shader<Shader>(font, text, x, y, color, wrapLength, lineSpacing, shaderArg); });
 }
@@ -0,0 +1,1800 @@
+// embedded_assets.hpp, written by embed_assets.py from res/CPFlappyBird, don't edit
+// included by draw_functions.hpp when the game is built with EMBEDDED_ASSETS
+
+#pragma once
+
+// background: 320x538 TEXTURE_TILED8, 27490 byte file
+const uint16_t embedded_background_palette[] = {
+	0xF81F, 0x4E19, 0x5619, 0x5639, 0x5E39, 0x6639, 0x6E59, 0xD7BA, 0xDFBA, 0xDFBB, 0x6659, 0xE7DB, 0xDFDB, 0xEFFB, 0x7659, 0x7679, 0xEFDB, 0xE7DA, 0xBF58, 0xBF38, 0xA6FA, 0xA6FB, 0xD779, 0xCF79,
+	0x9EFA, 0xE79A, 0x9EDA, 0xD778, 0xB738, 0xE799, 0xDF9A, 0xDF7A, 0x9EFB, 0xDF79, 0xD798, 0x9EDB, 0xA6DA, 0xAF38, 0xD77A, 0xCF78, 0x96DA, 0xD75A, 0xB737, 0xCF77, 0xAF17, 0x96D9, 0xC758, 0xC777,
+	0xE779, 0x9ED9, 0xC757, 0xAF37, 0xCF58, 0x7670, 0x6E6F, 0x666F, 0x5E6F, 0x6670, 0x8ED8, 0x6E70, 0x8ED9, 0xBF57, 0x6F0F, 0x670E, 0x6650, 0x8EB9, 0x5E4F, 0x66EE, 0x66EF, 0xD759, 0x6F0E, 0x8EB8,
+	0x5F0E, 0x5E50, 0x564F, 0x564E, 0x5EEE, 0x5E6E, 0x5EED, 0x5E4E, 0x564D, 0x664F, 0xA716, 0xC756, 0xBF56, 0x5F0D, 0x566D,
+};
+const uint8_t embedded_background_texels[] = {
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02,
+	0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x03, 0x03, 0x04, 0x04, 0x04, 0x04,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x03, 0x03, 0x04, 0x04, 0x04, 0x04, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x03, 0x03,
+	0x04, 0x04, 0x06, 0x06, 0x07, 0x07, 0x08, 0x08, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x03, 0x03, 0x04, 0x04, 0x06, 0x06, 0x07, 0x07, 0x08, 0x08,
+	0x02, 0x02, 0x02, 0x02, 0x04, 0x04, 0x06, 0x06, 0x07, 0x07, 0x09, 0x09, 0x0B, 0x0B, 0x0B, 0x0B, 0x02, 0x02, 0x02, 0x02, 0x04, 0x04, 0x06, 0x06,
+	0x07, 0x07, 0x09, 0x09, 0x0B, 0x0B, 0x0B, 0x0B, 0x04, 0x04, 0x0A, 0x0A, 0x07, 0x07, 0x09, 0x09, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D,
+	0x04, 0x04, 0x0A, 0x0A, 0x07, 0x07, 0x09, 0x09, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0E, 0x0E, 0x08, 0x08, 0x0B, 0x0B, 0x0B, 0x0B,
+	0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0E, 0x0E, 0x08, 0x08, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x05, 0x05, 0x05, 0x05, 0x04, 0x04, 0x04, 0x04, 0x03, 0x03, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x05, 0x05, 0x05, 0x05, 0x04, 0x04, 0x04, 0x04,
+	0x03, 0x03, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x09, 0x09, 0x09, 0x09, 0x08, 0x08, 0x07, 0x07, 0x06, 0x06, 0x04, 0x04, 0x03, 0x03, 0x02, 0x02,
+	0x09, 0x09, 0x09, 0x09, 0x08, 0x08, 0x07, 0x07, 0x06, 0x06, 0x04, 0x04, 0x03, 0x03, 0x02, 0x02, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+	0x09, 0x09, 0x07, 0x07, 0x06, 0x06, 0x04, 0x04, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x09, 0x09, 0x07, 0x07, 0x06, 0x06, 0x04, 0x04,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x09, 0x09, 0x07, 0x07, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B,
+	0x0B, 0x0B, 0x0B, 0x0B, 0x09, 0x09, 0x07, 0x07, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0A, 0x0A, 0x03, 0x03, 0x02, 0x02, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0A, 0x0A, 0x03, 0x03, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x08, 0x08, 0x0A, 0x0A, 0x03, 0x03, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x08, 0x08, 0x0A, 0x0A, 0x03, 0x03, 0x02, 0x02,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x0B, 0x08, 0x08, 0x0A, 0x0A, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x0B, 0x0B, 0x08, 0x08, 0x0A, 0x0A, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x0B, 0x0B, 0x0B, 0x07, 0x07, 0x04, 0x04,
+	0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x0B, 0x0B, 0x0B, 0x07, 0x07, 0x04, 0x04, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x0D, 0x0D, 0x0B, 0x0B, 0x09, 0x09, 0x06, 0x06, 0x03, 0x03, 0x02, 0x02, 0x01, 0x01, 0x02, 0x02, 0x0D, 0x0D, 0x0B, 0x0B, 0x09, 0x09, 0x06, 0x06,
+	0x03, 0x03, 0x02, 0x02, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01,
+	0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x03, 0x03, 0x04, 0x04, 0x04, 0x04, 0x05, 0x05,
+	0x05, 0x05, 0x04, 0x04, 0x04, 0x04, 0x03, 0x03, 0x03, 0x03, 0x04, 0x04, 0x04, 0x04, 0x05, 0x05, 0x05, 0x05, 0x04, 0x04, 0x04, 0x04, 0x03, 0x03,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x04, 0x04,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x04, 0x04, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x02, 0x02, 0x03, 0x03, 0x0A, 0x0A, 0x07, 0x07, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x03, 0x03, 0x0A, 0x0A, 0x07, 0x07,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x03, 0x03, 0x0A, 0x0A, 0x08, 0x08, 0x0B, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02,
+	0x03, 0x03, 0x0A, 0x0A, 0x08, 0x08, 0x0B, 0x0B, 0x02, 0x02, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x0A, 0x0A, 0x08, 0x08, 0x0B, 0x0B, 0x0B, 0x0B,
+	0x02, 0x02, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x0A, 0x0A, 0x08, 0x08, 0x0B, 0x0B, 0x0B, 0x0B, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02,
+	0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x02, 0x02, 0x03, 0x03, 0x04, 0x04, 0x04, 0x04, 0x05, 0x05, 0x05, 0x05, 0x04, 0x04,
+	0x01, 0x01, 0x02, 0x02, 0x03, 0x03, 0x04, 0x04, 0x04, 0x04, 0x05, 0x05, 0x05, 0x05, 0x04, 0x04, 0x03, 0x03, 0x04, 0x04, 0x06, 0x06, 0x07, 0x07,
+	0x08, 0x08, 0x09, 0x09, 0x09, 0x09, 0x08, 0x08, 0x03, 0x03, 0x04, 0x04, 0x06, 0x06, 0x07, 0x07, 0x08, 0x08, 0x09, 0x09, 0x09, 0x09, 0x08, 0x08,
+	0x06, 0x06, 0x07, 0x07, 0x09, 0x09, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x06, 0x06, 0x07, 0x07, 0x09, 0x09, 0x0B, 0x0B,
+	0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x09, 0x09, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x09, 0x09, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x04, 0x04, 0x03, 0x03, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x04, 0x04, 0x03, 0x03, 0x02, 0x02, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x07, 0x07, 0x06, 0x06, 0x04, 0x04, 0x03, 0x03, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x07, 0x07, 0x06, 0x06, 0x04, 0x04, 0x03, 0x03, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x0B, 0x09, 0x09, 0x07, 0x07, 0x06, 0x06,
+	0x04, 0x04, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x0B, 0x0B, 0x09, 0x09, 0x07, 0x07, 0x06, 0x06, 0x04, 0x04, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01,
+	0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x09, 0x09, 0x07, 0x07, 0x0A, 0x0A, 0x03, 0x03, 0x02, 0x02, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x09, 0x09,
+	0x07, 0x07, 0x0A, 0x0A, 0x03, 0x03, 0x02, 0x02, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x08, 0x08, 0x0A, 0x0A, 0x04, 0x04,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x08, 0x08, 0x0A, 0x0A, 0x04, 0x04, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0B, 0x0B, 0x0B, 0x0B, 0x08, 0x08, 0x0E, 0x0E, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B, 0x08, 0x08, 0x0E, 0x0E,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x03, 0x03, 0x04, 0x04, 0x04, 0x04, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x02, 0x02, 0x03, 0x03, 0x04, 0x04, 0x04, 0x04, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x03, 0x03, 0x04, 0x04, 0x06, 0x06, 0x07, 0x07, 0x08, 0x08,
+	0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x03, 0x03, 0x04, 0x04, 0x06, 0x06, 0x07, 0x07, 0x08, 0x08, 0x02, 0x02, 0x02, 0x02, 0x04, 0x04, 0x06, 0x06,
+	0x07, 0x07, 0x09, 0x09, 0x0B, 0x0B, 0x0B, 0x0B, 0x02, 0x02, 0x02, 0x02, 0x04, 0x04, 0x06, 0x06, 0x07, 0x07, 0x09, 0x09, 0x0B, 0x0B, 0x0B, 0x0B,
+	0x04, 0x04, 0x0A, 0x0A, 0x07, 0x07, 0x09, 0x09, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x04, 0x04, 0x0A, 0x0A, 0x07, 0x07, 0x09, 0x09,
+	0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0E, 0x0E, 0x08, 0x08, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0E, 0x0E, 0x08, 0x08, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x04, 0x04,
+	0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x04, 0x04, 0x05, 0x05, 0x05, 0x05, 0x04, 0x04, 0x04, 0x04,
+	0x03, 0x03, 0x04, 0x04, 0x0A, 0x0A, 0x07, 0x07, 0x05, 0x05, 0x05, 0x05, 0x04, 0x04, 0x04, 0x04, 0x03, 0x03, 0x04, 0x04, 0x0A, 0x0A, 0x07, 0x07,
+	0x09, 0x09, 0x09, 0x09, 0x08, 0x08, 0x07, 0x07, 0x06, 0x06, 0x0E, 0x0E, 0x08, 0x08, 0x0B, 0x0B, 0x09, 0x09, 0x09, 0x09, 0x08, 0x08, 0x07, 0x07,
+	0x06, 0x06, 0x0E, 0x0E, 0x08, 0x08, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0C, 0x0C, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+	0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0C, 0x0C, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B,
+	0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x01, 0x01, 0x02, 0x02, 0x03, 0x03, 0x04, 0x04, 0x04, 0x04, 0x05, 0x05, 0x05, 0x05, 0x04, 0x04,
+	0x01, 0x01, 0x02, 0x02, 0x03, 0x03, 0x04, 0x04, 0x04, 0x04, 0x05, 0x05, 0x05, 0x05, 0x04, 0x04, 0x03, 0x03, 0x04, 0x04, 0x06, 0x06, 0x07, 0x07,
+	0x08, 0x08, 0x09, 0x09, 0x09, 0x09, 0x08, 0x08, 0x03, 0x03, 0x04, 0x04, 0x06, 0x06, 0x07, 0x07, 0x08, 0x08, 0x09, 0x09, 0x09, 0x09, 0x08, 0x08,
+	0x06, 0x06, 0x07, 0x07, 0x09, 0x09, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x06, 0x06, 0x07, 0x07, 0x09, 0x09, 0x0B, 0x0B,
+	0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x09, 0x09, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x09, 0x09, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x04, 0x04, 0x03, 0x03, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x04, 0x04, 0x03, 0x03, 0x02, 0x02, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x07, 0x07, 0x06, 0x06, 0x04, 0x04, 0x03, 0x03, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x07, 0x07, 0x06, 0x06, 0x04, 0x04, 0x03, 0x03, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0B, 0x0B, 0x09, 0x09, 0x07, 0x07, 0x06, 0x06,
+	0x04, 0x04, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x0B, 0x0B, 0x09, 0x09, 0x07, 0x07, 0x06, 0x06, 0x04, 0x04, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01,
+	0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x09, 0x09, 0x07, 0x07, 0x0A, 0x0A, 0x03, 0x03, 0x02, 0x02, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x09, 0x09,
+	0x07, 0x07, 0x0A, 0x0A, 0x03, 0x03, 0x02, 0x02, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x08, 0x08, 0x0A, 0x0A, 0x03, 0x03,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x08, 0x08, 0x0A, 0x0A, 0x03, 0x03, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0B, 0x0B, 0x0B, 0x0B, 0x08, 0x08, 0x0A, 0x0A, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B, 0x08, 0x08, 0x0A, 0x0A,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B, 0x07, 0x07, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B, 0x07, 0x07, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x09, 0x09,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x09, 0x09, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x04, 0x04, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x04, 0x04, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02,
+	0x06, 0x06, 0x03, 0x03, 0x02, 0x02, 0x01, 0x01, 0x02, 0x02, 0x03, 0x03, 0x04, 0x04, 0x04, 0x04, 0x06, 0x06, 0x03, 0x03, 0x02, 0x02, 0x01, 0x01,
+	0x02, 0x02, 0x03, 0x03, 0x04, 0x04, 0x04, 0x04, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x05, 0x05, 0x05, 0x05, 0x04, 0x04, 0x04, 0x04,
+	0x03, 0x03, 0x02, 0x02, 0x01, 0x01, 0x02, 0x02, 0x05, 0x05, 0x05, 0x05, 0x04, 0x04, 0x04, 0x04, 0x03, 0x03, 0x02, 0x02, 0x01, 0x01, 0x02, 0x02,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x03, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x03, 0x03,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x03, 0x03, 0x04, 0x04, 0x06, 0x06, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x02, 0x02, 0x03, 0x03, 0x04, 0x04, 0x06, 0x06, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x04, 0x04, 0x06, 0x06, 0x07, 0x07, 0x09, 0x09,
+	0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x04, 0x04, 0x06, 0x06, 0x07, 0x07, 0x09, 0x09, 0x01, 0x01, 0x02, 0x02, 0x03, 0x03, 0x0A, 0x0A,
+	0x07, 0x07, 0x09, 0x09, 0x0B, 0x0B, 0x0B, 0x0B, 0x01, 0x01, 0x02, 0x02, 0x03, 0x03, 0x0A, 0x0A, 0x07, 0x07, 0x09, 0x09, 0x0B, 0x0B, 0x0B, 0x0B,
+	0x02, 0x02, 0x03, 0x03, 0x0A, 0x0A, 0x08, 0x08, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x02, 0x02, 0x03, 0x03, 0x0A, 0x0A, 0x08, 0x08,
+	0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x02, 0x02, 0x0A, 0x0A, 0x08, 0x08, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x02, 0x02, 0x0A, 0x0A, 0x08, 0x08, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x04, 0x04, 0x04, 0x04, 0x05, 0x05, 0x05, 0x05, 0x04, 0x04, 0x04, 0x04, 0x03, 0x03, 0x02, 0x02,
+	0x04, 0x04, 0x04, 0x04, 0x05, 0x05, 0x05, 0x05, 0x04, 0x04, 0x04, 0x04, 0x03, 0x03, 0x02, 0x02, 0x07, 0x07, 0x08, 0x08, 0x09, 0x09, 0x09, 0x09,
+	0x08, 0x08, 0x07, 0x07, 0x06, 0x06, 0x04, 0x04, 0x07, 0x07, 0x08, 0x08, 0x09, 0x09, 0x09, 0x09, 0x08, 0x08, 0x07, 0x07, 0x06, 0x06, 0x04, 0x04,
+	0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x09, 0x09, 0x07, 0x07, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+	0x0B, 0x0B, 0x0B, 0x0B, 0x09, 0x09, 0x07, 0x07, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+	0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x03, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x03, 0x03, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x06, 0x06, 0x04, 0x04, 0x02, 0x02, 0x02, 0x02,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x06, 0x06, 0x04, 0x04, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02,
+	0x09, 0x09, 0x07, 0x07, 0x0A, 0x0A, 0x03, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x04, 0x04, 0x09, 0x09, 0x07, 0x07, 0x0A, 0x0A, 0x03, 0x03,
+	0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x04, 0x04, 0x0B, 0x0B, 0x0B, 0x0B, 0x08, 0x08, 0x0A, 0x0A, 0x04, 0x04, 0x04, 0x04, 0x0A, 0x0A, 0x07, 0x07,
+	0x0B, 0x0B, 0x0B, 0x0B, 0x08, 0x08, 0x0A, 0x0A, 0x04, 0x04, 0x04, 0x04, 0x0A, 0x0A, 0x07, 0x07, 0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B, 0x08, 0x08,
+	0x0E, 0x0E, 0x0E, 0x0E, 0x08, 0x08, 0x0B, 0x0B, 0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B, 0x08, 0x08, 0x0E, 0x0E, 0x0E, 0x0E, 0x08, 0x08, 0x0B, 0x0B,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02,
+	0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+	0x01, 0x01, 0x02, 0x02, 0x03, 0x03, 0x04, 0x04, 0x04, 0x04, 0x05, 0x05, 0x05, 0x05, 0x04, 0x04, 0x01, 0x01, 0x02, 0x02, 0x03, 0x03, 0x04, 0x04,
+	0x04, 0x04, 0x05, 0x05, 0x05, 0x05, 0x04, 0x04, 0x03, 0x03, 0x04, 0x04, 0x06, 0x06, 0x07, 0x07, 0x08, 0x08, 0x09, 0x09, 0x09, 0x09, 0x08, 0x08,
+	0x03, 0x03, 0x04, 0x04, 0x06, 0x06, 0x07, 0x07, 0x08, 0x08, 0x09, 0x09, 0x09, 0x09, 0x08, 0x08, 0x06, 0x06, 0x07, 0x07, 0x09, 0x09, 0x0B, 0x0B,
+	0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x06, 0x06, 0x07, 0x07, 0x09, 0x09, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+	0x09, 0x09, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x09, 0x09, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x03, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x03, 0x03,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x03, 0x03, 0x04, 0x04, 0x06, 0x06, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x02, 0x02, 0x03, 0x03, 0x04, 0x04, 0x06, 0x06, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x04, 0x04, 0x06, 0x06, 0x07, 0x07, 0x09, 0x09,
+	0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x04, 0x04, 0x06, 0x06, 0x07, 0x07, 0x09, 0x09, 0x04, 0x04, 0x03, 0x03, 0x04, 0x04, 0x0A, 0x0A,
+	0x07, 0x07, 0x09, 0x09, 0x0B, 0x0B, 0x0B, 0x0B, 0x04, 0x04, 0x03, 0x03, 0x04, 0x04, 0x0A, 0x0A, 0x07, 0x07, 0x09, 0x09, 0x0B, 0x0B, 0x0B, 0x0B,
+	0x07, 0x07, 0x06, 0x06, 0x0E, 0x0E, 0x08, 0x08, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x07, 0x07, 0x06, 0x06, 0x0E, 0x0E, 0x08, 0x08,
+	0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0B, 0x0B, 0x0C, 0x0C, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0B, 0x0B, 0x0C, 0x0C, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x04, 0x04, 0x04, 0x04, 0x05, 0x05, 0x05, 0x05, 0x04, 0x04, 0x04, 0x04, 0x03, 0x03, 0x02, 0x02,
+	0x04, 0x04, 0x04, 0x04, 0x05, 0x05, 0x05, 0x05, 0x04, 0x04, 0x04, 0x04, 0x03, 0x03, 0x02, 0x02, 0x07, 0x07, 0x08, 0x08, 0x09, 0x09, 0x09, 0x09,
+	0x08, 0x08, 0x07, 0x07, 0x06, 0x06, 0x0A, 0x0A, 0x07, 0x07, 0x08, 0x08, 0x09, 0x09, 0x09, 0x09, 0x08, 0x08, 0x07, 0x07, 0x06, 0x06, 0x0A, 0x0A,
+	0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0C, 0x0C, 0x08, 0x08, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+	0x0B, 0x0B, 0x0B, 0x0B, 0x0C, 0x0C, 0x08, 0x08, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+	0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x04, 0x04, 0x03, 0x03, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x03, 0x03,
+	0x04, 0x04, 0x03, 0x03, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x03, 0x03, 0x07, 0x07, 0x06, 0x06, 0x04, 0x04, 0x03, 0x03,
+	0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x0A, 0x0A, 0x07, 0x07, 0x06, 0x06, 0x04, 0x04, 0x03, 0x03, 0x02, 0x02, 0x02, 0x02, 0x03, 0x03, 0x0A, 0x0A,
+	0x0B, 0x0B, 0x09, 0x09, 0x07, 0x07, 0x06, 0x06, 0x05, 0x05, 0x04, 0x04, 0x06, 0x06, 0x08, 0x08, 0x0B, 0x0B, 0x09, 0x09, 0x07, 0x07, 0x06, 0x06,
+	0x05, 0x05, 0x04, 0x04, 0x06, 0x06, 0x08, 0x08, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x09, 0x09, 0x08, 0x08, 0x0F, 0x0F, 0x09, 0x09, 0x0B, 0x0B,
+	0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x09, 0x09, 0x08, 0x08, 0x0F, 0x0F, 0x09, 0x09, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B,
+	0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x10, 0x10, 0x10, 0x10, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x10, 0x10, 0x10, 0x10, 0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B, 0x07, 0x07, 0x05, 0x05, 0x03, 0x03, 0x03, 0x03, 0x04, 0x04,
+	0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B, 0x07, 0x07, 0x05, 0x05, 0x03, 0x03, 0x03, 0x03, 0x04, 0x04, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0C, 0x0C,
+	0x0F, 0x0F, 0x06, 0x06, 0x06, 0x06, 0x07, 0x07, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0C, 0x0C, 0x0F, 0x0F, 0x06, 0x06, 0x06, 0x06, 0x07, 0x07,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x09, 0x09, 0x0C, 0x0C, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B,
+	0x0B, 0x0B, 0x09, 0x09, 0x0C, 0x0C, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x06, 0x06, 0x07, 0x07, 0x08, 0x08, 0x09, 0x09, 0x09, 0x09, 0x08, 0x08, 0x07, 0x07, 0x06, 0x06, 0x06, 0x06, 0x07, 0x07, 0x08, 0x08, 0x09, 0x09,
+	0x09, 0x09, 0x08, 0x08, 0x07, 0x07, 0x06, 0x06, 0x09, 0x09, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x09, 0x09,
+	0x09, 0x09, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x09, 0x09, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x10, 0x10, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x10, 0x10, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x11, 0x11,
+	0x11, 0x11, 0x11, 0x11, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0B, 0x0B, 0x0B, 0x0B,
+	0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B, 0x12, 0x12, 0x13, 0x13, 0x13, 0x13, 0x14, 0x14, 0x14, 0x14, 0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B, 0x12, 0x12,
+	0x13, 0x13, 0x13, 0x13, 0x14, 0x14, 0x14, 0x14, 0x0D, 0x0D, 0x0B, 0x0B, 0x11, 0x11, 0x13, 0x13, 0x16, 0x16, 0x17, 0x17, 0x18, 0x18, 0x16, 0x16,
+	0x0D, 0x0D, 0x0B, 0x0B, 0x11, 0x11, 0x13, 0x13, 0x16, 0x16, 0x17, 0x17, 0x18, 0x18, 0x16, 0x16, 0x04, 0x04, 0x03, 0x03, 0x03, 0x03, 0x05, 0x05,
+	0x07, 0x07, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x04, 0x04, 0x03, 0x03, 0x03, 0x03, 0x05, 0x05, 0x07, 0x07, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D,
+	0x07, 0x07, 0x06, 0x06, 0x06, 0x06, 0x0F, 0x0F, 0x0C, 0x0C, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x07, 0x07, 0x06, 0x06, 0x06, 0x06, 0x0F, 0x0F,
+	0x0C, 0x0C, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0C, 0x0C, 0x09, 0x09, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0B, 0x0B, 0x0C, 0x0C, 0x09, 0x09, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+	0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x14, 0x14, 0x15, 0x15, 0x15, 0x15, 0x0B, 0x0B,
+	0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x14, 0x14, 0x15, 0x15, 0x15, 0x15, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x16, 0x16, 0x16, 0x16, 0x15, 0x15, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x16, 0x16, 0x16, 0x16, 0x15, 0x15, 0x0B, 0x0B,
+	0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+	0x10, 0x10, 0x10, 0x10, 0x0D, 0x0D, 0x0D, 0x0D, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x10, 0x10, 0x0B, 0x0B, 0x0B, 0x0B,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x10, 0x10, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0B, 0x0B, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B, 0x12, 0x12, 0x13, 0x13, 0x13, 0x13, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B,
+	0x0B, 0x0B, 0x12, 0x12, 0x13, 0x13, 0x13, 0x13, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x11, 0x11, 0x13, 0x13, 0x16, 0x16, 0x17, 0x17,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x11, 0x11, 0x13, 0x13, 0x16, 0x16, 0x17, 0x17, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+	0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x15, 0x15,
+	0x15, 0x15, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x15, 0x15, 0x15, 0x15, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x18, 0x18, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x15, 0x15, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x18, 0x18, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+	0x15, 0x15, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x10, 0x10,
+	0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+	0x07, 0x07, 0x05, 0x05, 0x03, 0x03, 0x03, 0x03, 0x04, 0x04, 0x06, 0x06, 0x07, 0x07, 0x08, 0x08, 0x07, 0x07, 0x05, 0x05, 0x03, 0x03, 0x03, 0x03,
+	0x04, 0x04, 0x06, 0x06, 0x07, 0x07, 0x08, 0x08, 0x0C, 0x0C, 0x0F, 0x0F, 0x06, 0x06, 0x06, 0x06, 0x07, 0x07, 0x09, 0x09, 0x0B, 0x0B, 0x0B, 0x0B,
+	0x0C, 0x0C, 0x0F, 0x0F, 0x06, 0x06, 0x06, 0x06, 0x07, 0x07, 0x09, 0x09, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x09, 0x09, 0x0C, 0x0C,
+	0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B, 0x09, 0x09, 0x0C, 0x0C, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D,
+	0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+	0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B, 0x10, 0x10, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x11, 0x11,
+	0x10, 0x10, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x11, 0x11, 0x09, 0x09, 0x09, 0x09, 0x08, 0x08, 0x07, 0x07,
+	0x06, 0x06, 0x04, 0x04, 0x03, 0x03, 0x03, 0x03, 0x09, 0x09, 0x09, 0x09, 0x08, 0x08, 0x07, 0x07, 0x06, 0x06, 0x04, 0x04, 0x03, 0x03, 0x03, 0x03,
+	0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x09, 0x09, 0x07, 0x07, 0x06, 0x06, 0x06, 0x06, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+	0x09, 0x09, 0x07, 0x07, 0x06, 0x06, 0x06, 0x06, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0C, 0x0C, 0x09, 0x09,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0C, 0x0C, 0x09, 0x09, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+	0x10, 0x10, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x10, 0x10, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+	0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+	0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x12, 0x12, 0x13, 0x13, 0x13, 0x13, 0x14, 0x14,
+	0x14, 0x14, 0x14, 0x14, 0x15, 0x15, 0x15, 0x15, 0x12, 0x12, 0x13, 0x13, 0x13, 0x13, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x15, 0x15, 0x15, 0x15,
+	0x13, 0x13, 0x16, 0x16, 0x17, 0x17, 0x18, 0x18, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x15, 0x15, 0x13, 0x13, 0x16, 0x16, 0x17, 0x17, 0x18, 0x18,
+	0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x15, 0x15, 0x05, 0x05, 0x07, 0x07, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x05, 0x05, 0x07, 0x07, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0F, 0x0F, 0x0C, 0x0C, 0x0B, 0x0B, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0F, 0x0F, 0x0C, 0x0C, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B,
+	0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B,
+	0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x10, 0x10, 0x0B, 0x0B,
+	0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x10, 0x10, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+	0x0D, 0x0D, 0x0B, 0x0B, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0B, 0x0B, 0x11, 0x11, 0x11, 0x11,
+	0x11, 0x11, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x12, 0x12, 0x13, 0x13, 0x13, 0x13, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+	0x0B, 0x0B, 0x0B, 0x0B, 0x12, 0x12, 0x13, 0x13, 0x13, 0x13, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x0B, 0x0B, 0x11, 0x11, 0x13, 0x13, 0x16, 0x16,
+	0x17, 0x17, 0x18, 0x18, 0x16, 0x16, 0x16, 0x16, 0x0B, 0x0B, 0x11, 0x11, 0x13, 0x13, 0x16, 0x16, 0x17, 0x17, 0x18, 0x18, 0x16, 0x16, 0x16, 0x16,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x15, 0x15, 0x15, 0x15, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x15, 0x15, 0x15, 0x15, 0x0B, 0x0B, 0x0B, 0x0B,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x16, 0x16, 0x15, 0x15, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x16, 0x16, 0x15, 0x15, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x0D, 0x0D, 0x0D, 0x0D, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+	0x10, 0x10, 0x10, 0x10, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x20, 0x20, 0x15, 0x15, 0x15, 0x15, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x20, 0x20, 0x15, 0x15, 0x15, 0x15, 0x0B, 0x0B,
+	0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x1C, 0x1C, 0x17, 0x17, 0x20, 0x20, 0x09, 0x09, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+	0x1C, 0x1C, 0x17, 0x17, 0x20, 0x20, 0x09, 0x09, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x14, 0x14,
+	0x14, 0x14, 0x15, 0x15, 0x15, 0x15, 0x0B, 0x0B, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x14, 0x14, 0x14, 0x14, 0x15, 0x15, 0x15, 0x15, 0x0B, 0x0B,
+	0x1C, 0x1C, 0x27, 0x27, 0x1B, 0x1B, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x14, 0x14, 0x1F, 0x1F, 0x1C, 0x1C, 0x27, 0x27, 0x1B, 0x1B, 0x16, 0x16,
+	0x16, 0x16, 0x16, 0x16, 0x14, 0x14, 0x1F, 0x1F, 0x1C, 0x1C, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x16, 0x16, 0x14, 0x14, 0x1F, 0x1F,
+	0x1C, 0x1C, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x16, 0x16, 0x14, 0x14, 0x1F, 0x1F, 0x13, 0x13, 0x1B, 0x1B, 0x13, 0x13, 0x22, 0x22,
+	0x13, 0x13, 0x1B, 0x1B, 0x14, 0x14, 0x21, 0x21, 0x13, 0x13, 0x1B, 0x1B, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x1B, 0x1B, 0x14, 0x14, 0x21, 0x21,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x19, 0x19, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x19, 0x19, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x10, 0x10, 0x10, 0x10, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x10, 0x10, 0x10, 0x10, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0D, 0x0D, 0x0D, 0x0D, 0x10, 0x10, 0x10, 0x10,
+	0x19, 0x19, 0x19, 0x19, 0x1D, 0x1D, 0x1D, 0x1D, 0x0D, 0x0D, 0x0D, 0x0D, 0x10, 0x10, 0x10, 0x10, 0x19, 0x19, 0x19, 0x19, 0x1D, 0x1D, 0x1D, 0x1D,
+	0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x19, 0x19, 0x19, 0x19, 0x1D, 0x1D, 0x1D, 0x1D, 0x21, 0x21, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x19, 0x19,
+	0x19, 0x19, 0x1D, 0x1D, 0x1D, 0x1D, 0x21, 0x21, 0x0B, 0x0B, 0x10, 0x10, 0x10, 0x10, 0x19, 0x19, 0x1D, 0x1D, 0x1D, 0x1D, 0x21, 0x21, 0x21, 0x21,
+	0x0B, 0x0B, 0x10, 0x10, 0x10, 0x10, 0x19, 0x19, 0x1D, 0x1D, 0x1D, 0x1D, 0x21, 0x21, 0x21, 0x21, 0x19, 0x19, 0x19, 0x19, 0x11, 0x11, 0x19, 0x19,
+	0x1D, 0x1D, 0x21, 0x21, 0x21, 0x21, 0x14, 0x14, 0x19, 0x19, 0x19, 0x19, 0x11, 0x11, 0x19, 0x19, 0x1D, 0x1D, 0x21, 0x21, 0x21, 0x21, 0x14, 0x14,
+	0x1E, 0x1E, 0x19, 0x19, 0x11, 0x11, 0x19, 0x19, 0x1D, 0x1D, 0x21, 0x21, 0x21, 0x21, 0x24, 0x24, 0x1E, 0x1E, 0x19, 0x19, 0x11, 0x11, 0x19, 0x19,
+	0x1D, 0x1D, 0x21, 0x21, 0x21, 0x21, 0x24, 0x24, 0x1E, 0x1E, 0x19, 0x19, 0x11, 0x11, 0x19, 0x19, 0x1D, 0x1D, 0x21, 0x21, 0x21, 0x21, 0x24, 0x24,
+	0x1E, 0x1E, 0x19, 0x19, 0x11, 0x11, 0x19, 0x19, 0x1D, 0x1D, 0x21, 0x21, 0x21, 0x21, 0x24, 0x24, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+	0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+	0x1D, 0x1D, 0x1E, 0x1E, 0x1F, 0x1F, 0x1F, 0x1F, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x1D, 0x1D, 0x1E, 0x1E, 0x1F, 0x1F, 0x1F, 0x1F,
+	0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x21, 0x21, 0x21, 0x21, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x15, 0x15,
+	0x21, 0x21, 0x21, 0x21, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x15, 0x15, 0x1F, 0x1F, 0x1F, 0x1F, 0x24, 0x24, 0x17, 0x17,
+	0x17, 0x17, 0x16, 0x16, 0x17, 0x17, 0x1C, 0x1C, 0x1F, 0x1F, 0x1F, 0x1F, 0x24, 0x24, 0x17, 0x17, 0x17, 0x17, 0x16, 0x16, 0x17, 0x17, 0x1C, 0x1C,
+	0x1F, 0x1F, 0x26, 0x26, 0x1A, 0x1A, 0x17, 0x17, 0x1C, 0x1C, 0x17, 0x17, 0x17, 0x17, 0x1C, 0x1C, 0x1F, 0x1F, 0x26, 0x26, 0x1A, 0x1A, 0x17, 0x17,
+	0x1C, 0x1C, 0x17, 0x17, 0x17, 0x17, 0x1C, 0x1C, 0x24, 0x24, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A,
+	0x24, 0x24, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x17, 0x17, 0x16, 0x16, 0x1B, 0x1B, 0x1B, 0x1B,
+	0x1B, 0x1B, 0x27, 0x27, 0x1C, 0x1C, 0x1C, 0x1C, 0x17, 0x17, 0x16, 0x16, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x27, 0x27, 0x1C, 0x1C, 0x1C, 0x1C,
+	0x1C, 0x1C, 0x1B, 0x1B, 0x13, 0x13, 0x1B, 0x1B, 0x13, 0x13, 0x1B, 0x1B, 0x1C, 0x1C, 0x25, 0x25, 0x1C, 0x1C, 0x1B, 0x1B, 0x13, 0x13, 0x1B, 0x1B,
+	0x13, 0x13, 0x1B, 0x1B, 0x1C, 0x1C, 0x25, 0x25, 0x0B, 0x0B, 0x0B, 0x0B, 0x15, 0x15, 0x14, 0x14, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1B, 0x1B,
+	0x0B, 0x0B, 0x0B, 0x0B, 0x15, 0x15, 0x14, 0x14, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1B, 0x1B, 0x0B, 0x0B, 0x0B, 0x0B, 0x14, 0x14, 0x16, 0x16,
+	0x17, 0x17, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x0B, 0x0B, 0x0B, 0x0B, 0x14, 0x14, 0x16, 0x16, 0x17, 0x17, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+	0x15, 0x15, 0x09, 0x09, 0x14, 0x14, 0x16, 0x16, 0x13, 0x13, 0x1B, 0x1B, 0x13, 0x13, 0x22, 0x22, 0x15, 0x15, 0x09, 0x09, 0x14, 0x14, 0x16, 0x16,
+	0x13, 0x13, 0x1B, 0x1B, 0x13, 0x13, 0x22, 0x22, 0x23, 0x23, 0x09, 0x09, 0x14, 0x14, 0x16, 0x16, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x22, 0x22,
+	0x23, 0x23, 0x09, 0x09, 0x14, 0x14, 0x16, 0x16, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x22, 0x22, 0x1A, 0x1A, 0x09, 0x09, 0x18, 0x18, 0x16, 0x16,
+	0x1B, 0x1B, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x1A, 0x1A, 0x09, 0x09, 0x18, 0x18, 0x16, 0x16, 0x1B, 0x1B, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+	0x1A, 0x1A, 0x09, 0x09, 0x18, 0x18, 0x16, 0x16, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x22, 0x22, 0x1A, 0x1A, 0x09, 0x09, 0x18, 0x18, 0x16, 0x16,
+	0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x22, 0x22, 0x1A, 0x1A, 0x08, 0x08, 0x1A, 0x1A, 0x1B, 0x1B, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x22, 0x22,
+	0x1A, 0x1A, 0x08, 0x08, 0x1A, 0x1A, 0x1B, 0x1B, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x22, 0x22, 0x28, 0x28, 0x29, 0x29, 0x1A, 0x1A, 0x1B, 0x1B,
+	0x1B, 0x1B, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x28, 0x28, 0x29, 0x29, 0x1A, 0x1A, 0x1B, 0x1B, 0x1B, 0x1B, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+	0x1C, 0x1C, 0x16, 0x16, 0x14, 0x14, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x1C, 0x1C, 0x16, 0x16, 0x14, 0x14, 0x0B, 0x0B,
+	0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x1B, 0x1B, 0x16, 0x16, 0x14, 0x14, 0x09, 0x09, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D,
+	0x1B, 0x1B, 0x16, 0x16, 0x14, 0x14, 0x09, 0x09, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x13, 0x13, 0x1B, 0x1B, 0x1A, 0x1A, 0x23, 0x23,
+	0x20, 0x20, 0x15, 0x15, 0x0B, 0x0B, 0x0B, 0x0B, 0x13, 0x13, 0x1B, 0x1B, 0x1A, 0x1A, 0x23, 0x23, 0x20, 0x20, 0x15, 0x15, 0x0B, 0x0B, 0x0B, 0x0B,
+	0x13, 0x13, 0x1B, 0x1B, 0x1A, 0x1A, 0x25, 0x25, 0x17, 0x17, 0x20, 0x20, 0x09, 0x09, 0x0B, 0x0B, 0x13, 0x13, 0x1B, 0x1B, 0x1A, 0x1A, 0x25, 0x25,
+	0x17, 0x17, 0x20, 0x20, 0x09, 0x09, 0x0B, 0x0B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x14, 0x14, 0x14, 0x14,
+	0x1B, 0x1B, 0x1B, 0x1B, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x14, 0x14, 0x14, 0x14, 0x13, 0x13, 0x1B, 0x1B, 0x1A, 0x1A, 0x1C, 0x1C,
+	0x17, 0x17, 0x1B, 0x1B, 0x16, 0x16, 0x16, 0x16, 0x13, 0x13, 0x1B, 0x1B, 0x1A, 0x1A, 0x1C, 0x1C, 0x17, 0x17, 0x1B, 0x1B, 0x16, 0x16, 0x16, 0x16,
+	0x13, 0x13, 0x1B, 0x1B, 0x1A, 0x1A, 0x1C, 0x1C, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x13, 0x13, 0x1B, 0x1B, 0x1A, 0x1A, 0x1C, 0x1C,
+	0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1A, 0x1A, 0x1C, 0x1C, 0x1B, 0x1B, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13,
+	0x1B, 0x1B, 0x1B, 0x1B, 0x1A, 0x1A, 0x1C, 0x1C, 0x1B, 0x1B, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x10, 0x10, 0x10, 0x10, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x10, 0x10, 0x10, 0x10,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x10, 0x10, 0x10, 0x10, 0x19, 0x19, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x10, 0x10, 0x10, 0x10, 0x19, 0x19, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x10, 0x10, 0x10, 0x10, 0x19, 0x19, 0x19, 0x19,
+	0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x10, 0x10, 0x10, 0x10, 0x19, 0x19, 0x19, 0x19, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x10, 0x10,
+	0x10, 0x10, 0x19, 0x19, 0x19, 0x19, 0x1D, 0x1D, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x10, 0x10, 0x10, 0x10, 0x19, 0x19, 0x19, 0x19, 0x1D, 0x1D,
+	0x15, 0x15, 0x15, 0x15, 0x0B, 0x0B, 0x0B, 0x0B, 0x10, 0x10, 0x19, 0x19, 0x1D, 0x1D, 0x1D, 0x1D, 0x15, 0x15, 0x15, 0x15, 0x0B, 0x0B, 0x0B, 0x0B,
+	0x10, 0x10, 0x19, 0x19, 0x1D, 0x1D, 0x1D, 0x1D, 0x16, 0x16, 0x14, 0x14, 0x1E, 0x1E, 0x19, 0x19, 0x11, 0x11, 0x19, 0x19, 0x1D, 0x1D, 0x21, 0x21,
+	0x16, 0x16, 0x14, 0x14, 0x1E, 0x1E, 0x19, 0x19, 0x11, 0x11, 0x19, 0x19, 0x1D, 0x1D, 0x21, 0x21, 0x16, 0x16, 0x14, 0x14, 0x1F, 0x1F, 0x1E, 0x1E,
+	0x11, 0x11, 0x19, 0x19, 0x1D, 0x1D, 0x21, 0x21, 0x16, 0x16, 0x14, 0x14, 0x1F, 0x1F, 0x1E, 0x1E, 0x11, 0x11, 0x19, 0x19, 0x1D, 0x1D, 0x21, 0x21,
+	0x1B, 0x1B, 0x14, 0x14, 0x1F, 0x1F, 0x1E, 0x1E, 0x11, 0x11, 0x19, 0x19, 0x1D, 0x1D, 0x21, 0x21, 0x1B, 0x1B, 0x14, 0x14, 0x1F, 0x1F, 0x1E, 0x1E,
+	0x11, 0x11, 0x19, 0x19, 0x1D, 0x1D, 0x21, 0x21, 0x10, 0x10, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0B, 0x0B, 0x0B, 0x0B,
+	0x10, 0x10, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0B, 0x0B, 0x0B, 0x0B, 0x19, 0x19, 0x19, 0x19, 0x1D, 0x1D, 0x1E, 0x1E,
+	0x1F, 0x1F, 0x1F, 0x1F, 0x0B, 0x0B, 0x0B, 0x0B, 0x19, 0x19, 0x19, 0x19, 0x1D, 0x1D, 0x1E, 0x1E, 0x1F, 0x1F, 0x1F, 0x1F, 0x0B, 0x0B, 0x0B, 0x0B,
+	0x1D, 0x1D, 0x1D, 0x1D, 0x21, 0x21, 0x21, 0x21, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x1D, 0x1D, 0x1D, 0x1D, 0x21, 0x21, 0x21, 0x21,
+	0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x1D, 0x1D, 0x21, 0x21, 0x1F, 0x1F, 0x1F, 0x1F, 0x24, 0x24, 0x17, 0x17, 0x17, 0x17, 0x16, 0x16,
+	0x1D, 0x1D, 0x21, 0x21, 0x1F, 0x1F, 0x1F, 0x1F, 0x24, 0x24, 0x17, 0x17, 0x17, 0x17, 0x16, 0x16, 0x21, 0x21, 0x21, 0x21, 0x1F, 0x1F, 0x26, 0x26,
+	0x1A, 0x1A, 0x17, 0x17, 0x1C, 0x1C, 0x17, 0x17, 0x21, 0x21, 0x21, 0x21, 0x1F, 0x1F, 0x26, 0x26, 0x1A, 0x1A, 0x17, 0x17, 0x1C, 0x1C, 0x17, 0x17,
+	0x21, 0x21, 0x14, 0x14, 0x24, 0x24, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x21, 0x21, 0x14, 0x14, 0x24, 0x24, 0x1A, 0x1A,
+	0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x21, 0x21, 0x24, 0x24, 0x17, 0x17, 0x16, 0x16, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x27, 0x27,
+	0x21, 0x21, 0x24, 0x24, 0x17, 0x17, 0x16, 0x16, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x27, 0x27, 0x21, 0x21, 0x24, 0x24, 0x1C, 0x1C, 0x1B, 0x1B,
+	0x13, 0x13, 0x1B, 0x1B, 0x13, 0x13, 0x1B, 0x1B, 0x21, 0x21, 0x24, 0x24, 0x1C, 0x1C, 0x1B, 0x1B, 0x13, 0x13, 0x1B, 0x1B, 0x13, 0x13, 0x1B, 0x1B,
+	0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x15, 0x15, 0x14, 0x14, 0x1A, 0x1A, 0x1A, 0x1A, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+	0x15, 0x15, 0x14, 0x14, 0x1A, 0x1A, 0x1A, 0x1A, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x14, 0x14, 0x16, 0x16, 0x17, 0x17, 0x1B, 0x1B,
+	0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x14, 0x14, 0x16, 0x16, 0x17, 0x17, 0x1B, 0x1B, 0x14, 0x14, 0x15, 0x15, 0x15, 0x15, 0x09, 0x09,
+	0x14, 0x14, 0x16, 0x16, 0x13, 0x13, 0x1B, 0x1B, 0x14, 0x14, 0x15, 0x15, 0x15, 0x15, 0x09, 0x09, 0x14, 0x14, 0x16, 0x16, 0x13, 0x13, 0x1B, 0x1B,
+	0x17, 0x17, 0x1C, 0x1C, 0x23, 0x23, 0x09, 0x09, 0x14, 0x14, 0x16, 0x16, 0x13, 0x13, 0x22, 0x22, 0x17, 0x17, 0x1C, 0x1C, 0x23, 0x23, 0x09, 0x09,
+	0x14, 0x14, 0x16, 0x16, 0x13, 0x13, 0x22, 0x22, 0x17, 0x17, 0x1C, 0x1C, 0x1A, 0x1A, 0x09, 0x09, 0x18, 0x18, 0x16, 0x16, 0x1B, 0x1B, 0x22, 0x22,
+	0x17, 0x17, 0x1C, 0x1C, 0x1A, 0x1A, 0x09, 0x09, 0x18, 0x18, 0x16, 0x16, 0x1B, 0x1B, 0x22, 0x22, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x09, 0x09,
+	0x18, 0x18, 0x16, 0x16, 0x13, 0x13, 0x22, 0x22, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x09, 0x09, 0x18, 0x18, 0x16, 0x16, 0x13, 0x13, 0x22, 0x22,
+	0x1C, 0x1C, 0x1C, 0x1C, 0x1A, 0x1A, 0x08, 0x08, 0x1A, 0x1A, 0x1B, 0x1B, 0x13, 0x13, 0x22, 0x22, 0x1C, 0x1C, 0x1C, 0x1C, 0x1A, 0x1A, 0x08, 0x08,
+	0x1A, 0x1A, 0x1B, 0x1B, 0x13, 0x13, 0x22, 0x22, 0x1C, 0x1C, 0x25, 0x25, 0x28, 0x28, 0x29, 0x29, 0x1A, 0x1A, 0x1B, 0x1B, 0x1B, 0x1B, 0x22, 0x22,
+	0x1C, 0x1C, 0x25, 0x25, 0x28, 0x28, 0x29, 0x29, 0x1A, 0x1A, 0x1B, 0x1B, 0x1B, 0x1B, 0x22, 0x22, 0x1A, 0x1A, 0x1B, 0x1B, 0x1C, 0x1C, 0x16, 0x16,
+	0x14, 0x14, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x1A, 0x1A, 0x1B, 0x1B, 0x1C, 0x1C, 0x16, 0x16, 0x14, 0x14, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+	0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x16, 0x16, 0x14, 0x14, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x16, 0x16,
+	0x14, 0x14, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x1B, 0x1B, 0x1A, 0x1A, 0x20, 0x20, 0x15, 0x15, 0x15, 0x15,
+	0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x1B, 0x1B, 0x1A, 0x1A, 0x20, 0x20, 0x15, 0x15, 0x15, 0x15, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x1B, 0x1B,
+	0x1A, 0x1A, 0x1C, 0x1C, 0x17, 0x17, 0x20, 0x20, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x1B, 0x1B, 0x1A, 0x1A, 0x1C, 0x1C, 0x17, 0x17, 0x20, 0x20,
+	0x22, 0x22, 0x22, 0x22, 0x1B, 0x1B, 0x1B, 0x1B, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x22, 0x22, 0x22, 0x22, 0x1B, 0x1B, 0x1B, 0x1B,
+	0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x1B, 0x1B, 0x1A, 0x1A, 0x1C, 0x1C, 0x27, 0x27, 0x1B, 0x1B,
+	0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x1B, 0x1B, 0x1A, 0x1A, 0x1C, 0x1C, 0x27, 0x27, 0x1B, 0x1B, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x1B, 0x1B,
+	0x1A, 0x1A, 0x1C, 0x1C, 0x1B, 0x1B, 0x1B, 0x1B, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x1B, 0x1B, 0x1A, 0x1A, 0x1C, 0x1C, 0x1B, 0x1B, 0x1B, 0x1B,
+	0x22, 0x22, 0x22, 0x22, 0x1B, 0x1B, 0x1B, 0x1B, 0x1A, 0x1A, 0x13, 0x13, 0x1B, 0x1B, 0x13, 0x13, 0x22, 0x22, 0x22, 0x22, 0x1B, 0x1B, 0x1B, 0x1B,
+	0x1A, 0x1A, 0x13, 0x13, 0x1B, 0x1B, 0x13, 0x13, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x10, 0x10, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x10, 0x10, 0x09, 0x09, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+	0x09, 0x09, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x14, 0x14, 0x14, 0x14, 0x15, 0x15, 0x15, 0x15,
+	0x0B, 0x0B, 0x0B, 0x0B, 0x10, 0x10, 0x10, 0x10, 0x14, 0x14, 0x14, 0x14, 0x15, 0x15, 0x15, 0x15, 0x0B, 0x0B, 0x0B, 0x0B, 0x10, 0x10, 0x10, 0x10,
+	0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x14, 0x14, 0x1F, 0x1F, 0x19, 0x19, 0x19, 0x19, 0x11, 0x11, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x14, 0x14,
+	0x1F, 0x1F, 0x19, 0x19, 0x19, 0x19, 0x11, 0x11, 0x1B, 0x1B, 0x1B, 0x1B, 0x16, 0x16, 0x14, 0x14, 0x1F, 0x1F, 0x1E, 0x1E, 0x19, 0x19, 0x11, 0x11,
+	0x1B, 0x1B, 0x1B, 0x1B, 0x16, 0x16, 0x14, 0x14, 0x1F, 0x1F, 0x1E, 0x1E, 0x19, 0x19, 0x11, 0x11, 0x22, 0x22, 0x13, 0x13, 0x1B, 0x1B, 0x14, 0x14,
+	0x21, 0x21, 0x1E, 0x1E, 0x19, 0x19, 0x11, 0x11, 0x22, 0x22, 0x13, 0x13, 0x1B, 0x1B, 0x14, 0x14, 0x21, 0x21, 0x1E, 0x1E, 0x19, 0x19, 0x11, 0x11,
+	0x0D, 0x0D, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0D, 0x0D, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+	0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x10, 0x10, 0x10, 0x10, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1D, 0x1D, 0x1E, 0x1E, 0x1F, 0x1F,
+	0x10, 0x10, 0x10, 0x10, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1D, 0x1D, 0x1E, 0x1E, 0x1F, 0x1F, 0x10, 0x10, 0x19, 0x19, 0x19, 0x19, 0x1D, 0x1D,
+	0x1D, 0x1D, 0x21, 0x21, 0x21, 0x21, 0x14, 0x14, 0x10, 0x10, 0x19, 0x19, 0x19, 0x19, 0x1D, 0x1D, 0x1D, 0x1D, 0x21, 0x21, 0x21, 0x21, 0x14, 0x14,
+	0x19, 0x19, 0x19, 0x19, 0x1D, 0x1D, 0x1D, 0x1D, 0x21, 0x21, 0x1F, 0x1F, 0x1F, 0x1F, 0x24, 0x24, 0x19, 0x19, 0x19, 0x19, 0x1D, 0x1D, 0x1D, 0x1D,
+	0x21, 0x21, 0x1F, 0x1F, 0x1F, 0x1F, 0x24, 0x24, 0x19, 0x19, 0x1D, 0x1D, 0x1D, 0x1D, 0x21, 0x21, 0x21, 0x21, 0x1F, 0x1F, 0x26, 0x26, 0x1A, 0x1A,
+	0x19, 0x19, 0x1D, 0x1D, 0x1D, 0x1D, 0x21, 0x21, 0x21, 0x21, 0x1F, 0x1F, 0x26, 0x26, 0x1A, 0x1A, 0x19, 0x19, 0x1D, 0x1D, 0x21, 0x21, 0x21, 0x21,
+	0x14, 0x14, 0x24, 0x24, 0x1A, 0x1A, 0x1A, 0x1A, 0x19, 0x19, 0x1D, 0x1D, 0x21, 0x21, 0x21, 0x21, 0x14, 0x14, 0x24, 0x24, 0x1A, 0x1A, 0x1A, 0x1A,
+	0x19, 0x19, 0x1D, 0x1D, 0x21, 0x21, 0x21, 0x21, 0x24, 0x24, 0x17, 0x17, 0x16, 0x16, 0x1B, 0x1B, 0x19, 0x19, 0x1D, 0x1D, 0x21, 0x21, 0x21, 0x21,
+	0x24, 0x24, 0x17, 0x17, 0x16, 0x16, 0x1B, 0x1B, 0x19, 0x19, 0x1D, 0x1D, 0x21, 0x21, 0x21, 0x21, 0x24, 0x24, 0x1C, 0x1C, 0x1B, 0x1B, 0x13, 0x13,
+	0x19, 0x19, 0x1D, 0x1D, 0x21, 0x21, 0x21, 0x21, 0x24, 0x24, 0x1C, 0x1C, 0x1B, 0x1B, 0x13, 0x13, 0x19, 0x19, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+	0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x15, 0x15, 0x19, 0x19, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x15, 0x15,
+	0x1F, 0x1F, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x14, 0x14, 0x1F, 0x1F, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+	0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x15, 0x15, 0x15, 0x15, 0x09, 0x09, 0x14, 0x14,
+	0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x15, 0x15, 0x15, 0x15, 0x09, 0x09, 0x14, 0x14, 0x17, 0x17, 0x17, 0x17, 0x16, 0x16, 0x17, 0x17,
+	0x1C, 0x1C, 0x23, 0x23, 0x09, 0x09, 0x14, 0x14, 0x17, 0x17, 0x17, 0x17, 0x16, 0x16, 0x17, 0x17, 0x1C, 0x1C, 0x23, 0x23, 0x09, 0x09, 0x14, 0x14,
+	0x17, 0x17, 0x1C, 0x1C, 0x17, 0x17, 0x17, 0x17, 0x1C, 0x1C, 0x1A, 0x1A, 0x09, 0x09, 0x18, 0x18, 0x17, 0x17, 0x1C, 0x1C, 0x17, 0x17, 0x17, 0x17,
+	0x1C, 0x1C, 0x1A, 0x1A, 0x09, 0x09, 0x18, 0x18, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x09, 0x09, 0x18, 0x18,
+	0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x09, 0x09, 0x18, 0x18, 0x1B, 0x1B, 0x1B, 0x1B, 0x27, 0x27, 0x1C, 0x1C,
+	0x1C, 0x1C, 0x1A, 0x1A, 0x08, 0x08, 0x1A, 0x1A, 0x1B, 0x1B, 0x1B, 0x1B, 0x27, 0x27, 0x1C, 0x1C, 0x1C, 0x1C, 0x1A, 0x1A, 0x08, 0x08, 0x1A, 0x1A,
+	0x1B, 0x1B, 0x13, 0x13, 0x1B, 0x1B, 0x1C, 0x1C, 0x25, 0x25, 0x28, 0x28, 0x29, 0x29, 0x1A, 0x1A, 0x1B, 0x1B, 0x13, 0x13, 0x1B, 0x1B, 0x1C, 0x1C,
+	0x25, 0x25, 0x28, 0x28, 0x29, 0x29, 0x1A, 0x1A, 0x14, 0x14, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1B, 0x1B, 0x1C, 0x1C, 0x16, 0x16, 0x14, 0x14,
+	0x14, 0x14, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1B, 0x1B, 0x1C, 0x1C, 0x16, 0x16, 0x14, 0x14, 0x16, 0x16, 0x17, 0x17, 0x1B, 0x1B, 0x1B, 0x1B,
+	0x1B, 0x1B, 0x1B, 0x1B, 0x16, 0x16, 0x14, 0x14, 0x16, 0x16, 0x17, 0x17, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x16, 0x16, 0x14, 0x14,
+	0x16, 0x16, 0x13, 0x13, 0x1B, 0x1B, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x1B, 0x1B, 0x1A, 0x1A, 0x16, 0x16, 0x13, 0x13, 0x1B, 0x1B, 0x13, 0x13,
+	0x22, 0x22, 0x13, 0x13, 0x1B, 0x1B, 0x1A, 0x1A, 0x16, 0x16, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x1B, 0x1B, 0x1A, 0x1A,
+	0x16, 0x16, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x1B, 0x1B, 0x1A, 0x1A, 0x16, 0x16, 0x1B, 0x1B, 0x22, 0x22, 0x22, 0x22,
+	0x22, 0x22, 0x1B, 0x1B, 0x1B, 0x1B, 0x1A, 0x1A, 0x16, 0x16, 0x1B, 0x1B, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x1B, 0x1B, 0x1B, 0x1B, 0x1A, 0x1A,
+	0x16, 0x16, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x1B, 0x1B, 0x1A, 0x1A, 0x16, 0x16, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13,
+	0x22, 0x22, 0x13, 0x13, 0x1B, 0x1B, 0x1A, 0x1A, 0x1B, 0x1B, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x1B, 0x1B, 0x1A, 0x1A,
+	0x1B, 0x1B, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x1B, 0x1B, 0x1A, 0x1A, 0x1B, 0x1B, 0x1B, 0x1B, 0x22, 0x22, 0x22, 0x22,
+	0x22, 0x22, 0x1B, 0x1B, 0x1B, 0x1B, 0x1A, 0x1A, 0x1B, 0x1B, 0x1B, 0x1B, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x1B, 0x1B, 0x1B, 0x1B, 0x1A, 0x1A,
+	0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x09, 0x09, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x09, 0x09, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x23, 0x23, 0x20, 0x20, 0x15, 0x15, 0x0B, 0x0B,
+	0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x23, 0x23, 0x20, 0x20, 0x15, 0x15, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D,
+	0x25, 0x25, 0x17, 0x17, 0x20, 0x20, 0x09, 0x09, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x25, 0x25, 0x17, 0x17, 0x20, 0x20, 0x09, 0x09,
+	0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x14, 0x14, 0x14, 0x14, 0x15, 0x15, 0x15, 0x15, 0x0B, 0x0B,
+	0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x14, 0x14, 0x14, 0x14, 0x15, 0x15, 0x15, 0x15, 0x0B, 0x0B, 0x1C, 0x1C, 0x17, 0x17, 0x1B, 0x1B, 0x16, 0x16,
+	0x16, 0x16, 0x16, 0x16, 0x14, 0x14, 0x1E, 0x1E, 0x1C, 0x1C, 0x17, 0x17, 0x1B, 0x1B, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x14, 0x14, 0x1E, 0x1E,
+	0x1C, 0x1C, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x16, 0x16, 0x14, 0x14, 0x1F, 0x1F, 0x1C, 0x1C, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+	0x1B, 0x1B, 0x16, 0x16, 0x14, 0x14, 0x1F, 0x1F, 0x1C, 0x1C, 0x1B, 0x1B, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x1B, 0x1B, 0x14, 0x14, 0x1F, 0x1F,
+	0x1C, 0x1C, 0x1B, 0x1B, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x1B, 0x1B, 0x14, 0x14, 0x1F, 0x1F, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x10, 0x10,
+	0x10, 0x10, 0x10, 0x10, 0x19, 0x19, 0x19, 0x19, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x19, 0x19, 0x19, 0x19,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x10, 0x10, 0x10, 0x10, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1D, 0x1D, 0x0D, 0x0D, 0x0D, 0x0D, 0x10, 0x10, 0x10, 0x10,
+	0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x1D, 0x1D, 0x0D, 0x0D, 0x10, 0x10, 0x10, 0x10, 0x19, 0x19, 0x19, 0x19, 0x1D, 0x1D, 0x1D, 0x1D, 0x21, 0x21,
+	0x0D, 0x0D, 0x10, 0x10, 0x10, 0x10, 0x19, 0x19, 0x19, 0x19, 0x1D, 0x1D, 0x1D, 0x1D, 0x21, 0x21, 0x10, 0x10, 0x10, 0x10, 0x19, 0x19, 0x19, 0x19,
+	0x1D, 0x1D, 0x1D, 0x1D, 0x21, 0x21, 0x1F, 0x1F, 0x10, 0x10, 0x10, 0x10, 0x19, 0x19, 0x19, 0x19, 0x1D, 0x1D, 0x1D, 0x1D, 0x21, 0x21, 0x1F, 0x1F,
+	0x0B, 0x0B, 0x10, 0x10, 0x19, 0x19, 0x1D, 0x1D, 0x1D, 0x1D, 0x21, 0x21, 0x21, 0x21, 0x1F, 0x1F, 0x0B, 0x0B, 0x10, 0x10, 0x19, 0x19, 0x1D, 0x1D,
+	0x1D, 0x1D, 0x21, 0x21, 0x21, 0x21, 0x1F, 0x1F, 0x19, 0x19, 0x11, 0x11, 0x19, 0x19, 0x1D, 0x1D, 0x21, 0x21, 0x21, 0x21, 0x14, 0x14, 0x24, 0x24,
+	0x19, 0x19, 0x11, 0x11, 0x19, 0x19, 0x1D, 0x1D, 0x21, 0x21, 0x21, 0x21, 0x14, 0x14, 0x24, 0x24, 0x1E, 0x1E, 0x11, 0x11, 0x19, 0x19, 0x1D, 0x1D,
+	0x21, 0x21, 0x21, 0x21, 0x24, 0x24, 0x17, 0x17, 0x1E, 0x1E, 0x11, 0x11, 0x19, 0x19, 0x1D, 0x1D, 0x21, 0x21, 0x21, 0x21, 0x24, 0x24, 0x17, 0x17,
+	0x1E, 0x1E, 0x11, 0x11, 0x19, 0x19, 0x1D, 0x1D, 0x21, 0x21, 0x21, 0x21, 0x24, 0x24, 0x1C, 0x1C, 0x1E, 0x1E, 0x11, 0x11, 0x19, 0x19, 0x1D, 0x1D,
+	0x21, 0x21, 0x21, 0x21, 0x24, 0x24, 0x1C, 0x1C, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+	0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x1E, 0x1E, 0x1F, 0x1F, 0x1F, 0x1F, 0x0B, 0x0B,
+	0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x1E, 0x1E, 0x1F, 0x1F, 0x1F, 0x1F, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+	0x21, 0x21, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x15, 0x15, 0x15, 0x15, 0x21, 0x21, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+	0x14, 0x14, 0x14, 0x14, 0x15, 0x15, 0x15, 0x15, 0x1F, 0x1F, 0x24, 0x24, 0x17, 0x17, 0x17, 0x17, 0x16, 0x16, 0x17, 0x17, 0x1C, 0x1C, 0x23, 0x23,
+	0x1F, 0x1F, 0x24, 0x24, 0x17, 0x17, 0x17, 0x17, 0x16, 0x16, 0x17, 0x17, 0x1C, 0x1C, 0x23, 0x23, 0x26, 0x26, 0x1A, 0x1A, 0x17, 0x17, 0x1C, 0x1C,
+	0x17, 0x17, 0x17, 0x17, 0x1C, 0x1C, 0x1A, 0x1A, 0x26, 0x26, 0x1A, 0x1A, 0x17, 0x17, 0x1C, 0x1C, 0x17, 0x17, 0x17, 0x17, 0x1C, 0x1C, 0x1A, 0x1A,
+	0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A,
+	0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x16, 0x16, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x27, 0x27, 0x1C, 0x1C, 0x1C, 0x1C, 0x1A, 0x1A,
+	0x16, 0x16, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x27, 0x27, 0x1C, 0x1C, 0x1C, 0x1C, 0x1A, 0x1A, 0x1B, 0x1B, 0x13, 0x13, 0x1B, 0x1B, 0x13, 0x13,
+	0x1B, 0x1B, 0x1C, 0x1C, 0x25, 0x25, 0x28, 0x28, 0x1B, 0x1B, 0x13, 0x13, 0x1B, 0x1B, 0x13, 0x13, 0x1B, 0x1B, 0x1C, 0x1C, 0x25, 0x25, 0x28, 0x28,
+	0x0B, 0x0B, 0x15, 0x15, 0x14, 0x14, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1B, 0x1B, 0x1C, 0x1C, 0x0B, 0x0B, 0x15, 0x15, 0x14, 0x14, 0x1A, 0x1A,
+	0x1A, 0x1A, 0x1A, 0x1A, 0x1B, 0x1B, 0x1C, 0x1C, 0x0B, 0x0B, 0x14, 0x14, 0x16, 0x16, 0x17, 0x17, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+	0x0B, 0x0B, 0x14, 0x14, 0x16, 0x16, 0x17, 0x17, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x09, 0x09, 0x14, 0x14, 0x16, 0x16, 0x13, 0x13,
+	0x1B, 0x1B, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x09, 0x09, 0x14, 0x14, 0x16, 0x16, 0x13, 0x13, 0x1B, 0x1B, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13,
+	0x09, 0x09, 0x14, 0x14, 0x16, 0x16, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x09, 0x09, 0x14, 0x14, 0x16, 0x16, 0x13, 0x13,
+	0x22, 0x22, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x09, 0x09, 0x18, 0x18, 0x16, 0x16, 0x1B, 0x1B, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x1B, 0x1B,
+	0x09, 0x09, 0x18, 0x18, 0x16, 0x16, 0x1B, 0x1B, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x1B, 0x1B, 0x09, 0x09, 0x18, 0x18, 0x16, 0x16, 0x13, 0x13,
+	0x22, 0x22, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x09, 0x09, 0x18, 0x18, 0x16, 0x16, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13,
+	0x08, 0x08, 0x1A, 0x1A, 0x1B, 0x1B, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x08, 0x08, 0x1A, 0x1A, 0x1B, 0x1B, 0x13, 0x13,
+	0x22, 0x22, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x29, 0x29, 0x1A, 0x1A, 0x1B, 0x1B, 0x1B, 0x1B, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x1B, 0x1B,
+	0x29, 0x29, 0x1A, 0x1A, 0x1B, 0x1B, 0x1B, 0x1B, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x1B, 0x1B, 0x16, 0x16, 0x14, 0x14, 0x0B, 0x0B, 0x0B, 0x0B,
+	0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x16, 0x16, 0x14, 0x14, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x16, 0x16, 0x14, 0x14, 0x09, 0x09, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x16, 0x16, 0x14, 0x14, 0x09, 0x09, 0x0B, 0x0B,
+	0x0B, 0x0B, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x1B, 0x1B, 0x1A, 0x1A, 0x23, 0x23, 0x20, 0x20, 0x15, 0x15, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+	0x1B, 0x1B, 0x1A, 0x1A, 0x23, 0x23, 0x20, 0x20, 0x15, 0x15, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x1B, 0x1B, 0x1A, 0x1A, 0x25, 0x25, 0x17, 0x17,
+	0x20, 0x20, 0x09, 0x09, 0x0B, 0x0B, 0x0B, 0x0B, 0x1B, 0x1B, 0x1A, 0x1A, 0x25, 0x25, 0x17, 0x17, 0x20, 0x20, 0x09, 0x09, 0x0B, 0x0B, 0x0B, 0x0B,
+	0x1B, 0x1B, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x14, 0x14, 0x14, 0x14, 0x15, 0x15, 0x1B, 0x1B, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A,
+	0x1A, 0x1A, 0x14, 0x14, 0x14, 0x14, 0x15, 0x15, 0x1B, 0x1B, 0x1A, 0x1A, 0x1C, 0x1C, 0x17, 0x17, 0x1B, 0x1B, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+	0x1B, 0x1B, 0x1A, 0x1A, 0x1C, 0x1C, 0x17, 0x17, 0x1B, 0x1B, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x1B, 0x1B, 0x1A, 0x1A, 0x1C, 0x1C, 0x1B, 0x1B,
+	0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x16, 0x16, 0x1B, 0x1B, 0x1A, 0x1A, 0x1C, 0x1C, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x16, 0x16,
+	0x1B, 0x1B, 0x1A, 0x1A, 0x1C, 0x1C, 0x1B, 0x1B, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x1B, 0x1B, 0x1B, 0x1B, 0x1A, 0x1A, 0x1C, 0x1C, 0x1B, 0x1B,
+	0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x1B, 0x1B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x10, 0x10, 0x10, 0x10,
+	0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x10, 0x10, 0x10, 0x10, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x0D, 0x0D, 0x10, 0x10, 0x10, 0x10, 0x19, 0x19, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x10, 0x10, 0x10, 0x10, 0x19, 0x19,
+	0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x10, 0x10, 0x10, 0x10, 0x19, 0x19, 0x19, 0x19, 0x0B, 0x0B, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
+	0x10, 0x10, 0x10, 0x10, 0x19, 0x19, 0x19, 0x19, 0x0B, 0x0B, 0x0B, 0x0B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x19, 0x19, 0x19, 0x19, 0x1D, 0x1D,
+	0x0B, 0x0B, 0x0B, 0x0B, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x19, 0x19, 0x19, 0x19, 0x1D, 0x1D, 0x15, 0x15, 0x0B, 0x0B, 0x0B, 0x0B, 0x10, 0x10,
+	0x10, 0x10, 0x19, 0x19, 0x1D, 0x1D, 0x1D, 0x1D, 0x15, 0x15, 0x0B, 0x0B, 0x0B, 0x0B, 0x10, 0x10, 0x10, 0x10, 0x19, 0x19, 0x1D, 0x1D, 0x1D, 0x1D,
+	0x14, 0x14, 0x1F, 0x1F, 0x19, 0x19, 0x19, 0x19, 0x11, 0x11, 0x19, 0x19, 0x1D, 0x1D, 0x21, 0x21, 0x14, 0x14, 0x1F, 0x1F, 0x19, 0x19, 0x19, 0x19,
+	0x11, 0x11, 0x19, 0x19, 0x1D, 0x1D, 0x21, 0x21, 0x14, 0x14, 0x1F, 0x1F, 0x1E, 0x1E, 0x19, 0x19, 0x11, 0x11, 0x19, 0x19, 0x1D, 0x1D, 0x21, 0x21,
+	0x14, 0x14, 0x1F, 0x1F, 0x1E, 0x1E, 0x19, 0x19, 0x11, 0x11, 0x19, 0x19, 0x1D, 0x1D, 0x21, 0x21, 0x14, 0x14, 0x21, 0x21, 0x1E, 0x1E, 0x19, 0x19,
+	0x11, 0x11, 0x19, 0x19, 0x1D, 0x1D, 0x21, 0x21, 0x14, 0x14, 0x21, 0x21, 0x1E, 0x1E, 0x19, 0x19, 0x11, 0x11, 0x19, 0x19, 0x1D, 0x1D, 0x21, 0x21,
+	0x13, 0x13, 0x1B, 0x1B, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x1B, 0x1B, 0x14, 0x14, 0x21, 0x21, 0x13, 0x13, 0x1B, 0x1B, 0x13, 0x13, 0x22, 0x22,
+	0x13, 0x13, 0x1B, 0x1B, 0x14, 0x14, 0x21, 0x21, 0x13, 0x13, 0x1B, 0x1B, 0x1B, 0x1B, 0x22, 0x22, 0x1B, 0x1B, 0x1B, 0x1B, 0x14, 0x14, 0x21, 0x21,
+	0x13, 0x13, 0x1B, 0x1B, 0x1B, 0x1B, 0x22, 0x22, 0x1B, 0x1B, 0x1B, 0x1B, 0x14, 0x14, 0x21, 0x21, 0x13, 0x13, 0x1B, 0x1B, 0x13, 0x13, 0x22, 0x22,
+	0x13, 0x13, 0x1B, 0x1B, 0x14, 0x14, 0x21, 0x21, 0x13, 0x13, 0x1B, 0x1B, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x1B, 0x1B, 0x14, 0x14, 0x21, 0x21,
+	0x1C, 0x1C, 0x1B, 0x1B, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x1B, 0x1B, 0x14, 0x14, 0x21, 0x21, 0x1C, 0x1C, 0x1B, 0x1B, 0x13, 0x13, 0x22, 0x22,
+	0x13, 0x13, 0x1B, 0x1B, 0x14, 0x14, 0x21, 0x21, 0x1C, 0x1C, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x24, 0x24, 0x16, 0x16,
+	0x1C, 0x1C, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x24, 0x24, 0x16, 0x16, 0x1A, 0x1A, 0x17, 0x17, 0x14, 0x14, 0x1B, 0x1B,
+	0x1A, 0x1A, 0x27, 0x27, 0x1A, 0x1A, 0x34, 0x34, 0x1A, 0x1A, 0x17, 0x17, 0x14, 0x14, 0x1B, 0x1B, 0x1A, 0x1A, 0x27, 0x27, 0x1A, 0x1A, 0x34, 0x34,
+	0x28, 0x28, 0x27, 0x27, 0x1A, 0x1A, 0x27, 0x27, 0x1A, 0x1A, 0x2E, 0x2E, 0x3C, 0x3C, 0x39, 0x39, 0x28, 0x28, 0x27, 0x27, 0x1A, 0x1A, 0x27, 0x27,
+	0x1A, 0x1A, 0x2E, 0x2E, 0x3C, 0x3C, 0x39, 0x39, 0x41, 0x41, 0x32, 0x32, 0x32, 0x32, 0x2B, 0x2B, 0x32, 0x32, 0x39, 0x39, 0x38, 0x38, 0x44, 0x44,
+	0x41, 0x41, 0x32, 0x32, 0x32, 0x32, 0x2B, 0x2B, 0x32, 0x32, 0x39, 0x39, 0x38, 0x38, 0x44, 0x44, 0x1E, 0x1E, 0x19, 0x19, 0x11, 0x11, 0x19, 0x19,
+	0x1D, 0x1D, 0x21, 0x21, 0x21, 0x21, 0x14, 0x14, 0x1E, 0x1E, 0x19, 0x19, 0x11, 0x11, 0x19, 0x19, 0x1D, 0x1D, 0x21, 0x21, 0x21, 0x21, 0x14, 0x14,
+	0x1F, 0x1F, 0x19, 0x19, 0x11, 0x11, 0x19, 0x19, 0x1D, 0x1D, 0x21, 0x21, 0x21, 0x21, 0x14, 0x14, 0x1F, 0x1F, 0x19, 0x19, 0x11, 0x11, 0x19, 0x19,
+	0x1D, 0x1D, 0x21, 0x21, 0x21, 0x21, 0x14, 0x14, 0x1F, 0x1F, 0x1D, 0x1D, 0x11, 0x11, 0x1D, 0x1D, 0x1D, 0x1D, 0x21, 0x21, 0x21, 0x21, 0x14, 0x14,
+	0x1F, 0x1F, 0x1D, 0x1D, 0x11, 0x11, 0x1D, 0x1D, 0x1D, 0x1D, 0x21, 0x21, 0x21, 0x21, 0x14, 0x14, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21,
+	0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x24, 0x24, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x24, 0x24,
+	0x16, 0x16, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x16, 0x16, 0x16, 0x16, 0x1A, 0x1A, 0x16, 0x16, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+	0x1B, 0x1B, 0x16, 0x16, 0x16, 0x16, 0x1A, 0x1A, 0x34, 0x34, 0x35, 0x35, 0x36, 0x36, 0x36, 0x36, 0x35, 0x35, 0x34, 0x34, 0x34, 0x34, 0x28, 0x28,
+	0x34, 0x34, 0x35, 0x35, 0x36, 0x36, 0x36, 0x36, 0x35, 0x35, 0x34, 0x34, 0x34, 0x34, 0x28, 0x28, 0x37, 0x37, 0x3E, 0x3E, 0x3F, 0x3F, 0x3F, 0x3F,
+	0x3E, 0x3E, 0x37, 0x37, 0x40, 0x40, 0x41, 0x41, 0x37, 0x37, 0x3E, 0x3E, 0x3F, 0x3F, 0x3F, 0x3F, 0x3E, 0x3E, 0x37, 0x37, 0x40, 0x40, 0x41, 0x41,
+	0x3F, 0x3F, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x43, 0x43, 0x44, 0x44, 0x42, 0x42, 0x3F, 0x3F, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x48, 0x48, 0x43, 0x43, 0x44, 0x44, 0x42, 0x42, 0x1C, 0x1C, 0x1B, 0x1B, 0x13, 0x13, 0x1B, 0x1B, 0x13, 0x13, 0x1B, 0x1B, 0x1C, 0x1C, 0x1C, 0x1C,
+	0x1C, 0x1C, 0x1B, 0x1B, 0x13, 0x13, 0x1B, 0x1B, 0x13, 0x13, 0x1B, 0x1B, 0x1C, 0x1C, 0x1C, 0x1C, 0x1B, 0x1B, 0x1B, 0x1B, 0x22, 0x22, 0x1B, 0x1B,
+	0x1B, 0x1B, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1B, 0x1B, 0x1B, 0x1B, 0x22, 0x22, 0x1B, 0x1B, 0x1B, 0x1B, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A,
+	0x1C, 0x1C, 0x1B, 0x1B, 0x13, 0x13, 0x1B, 0x1B, 0x1C, 0x1C, 0x1A, 0x1A, 0x17, 0x17, 0x27, 0x27, 0x1C, 0x1C, 0x1B, 0x1B, 0x13, 0x13, 0x1B, 0x1B,
+	0x1C, 0x1C, 0x1A, 0x1A, 0x17, 0x17, 0x27, 0x27, 0x1C, 0x1C, 0x1B, 0x1B, 0x13, 0x13, 0x1B, 0x1B, 0x1C, 0x1C, 0x1A, 0x1A, 0x27, 0x27, 0x1C, 0x1C,
+	0x1C, 0x1C, 0x1B, 0x1B, 0x13, 0x13, 0x1B, 0x1B, 0x1C, 0x1C, 0x1A, 0x1A, 0x27, 0x27, 0x1C, 0x1C, 0x17, 0x17, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+	0x17, 0x17, 0x1A, 0x1A, 0x27, 0x27, 0x2A, 0x2A, 0x17, 0x17, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x17, 0x17, 0x1A, 0x1A, 0x27, 0x27, 0x2A, 0x2A,
+	0x1A, 0x1A, 0x27, 0x27, 0x1A, 0x1A, 0x27, 0x27, 0x28, 0x28, 0x28, 0x28, 0x32, 0x32, 0x32, 0x32, 0x1A, 0x1A, 0x27, 0x27, 0x1A, 0x1A, 0x27, 0x27,
+	0x28, 0x28, 0x28, 0x28, 0x32, 0x32, 0x32, 0x32, 0x41, 0x41, 0x2E, 0x2E, 0x2D, 0x2D, 0x2E, 0x2E, 0x41, 0x41, 0x41, 0x41, 0x40, 0x40, 0x42, 0x42,
+	0x41, 0x41, 0x2E, 0x2E, 0x2D, 0x2D, 0x2E, 0x2E, 0x41, 0x41, 0x41, 0x41, 0x40, 0x40, 0x42, 0x42, 0x49, 0x49, 0x3D, 0x3D, 0x3D, 0x3D, 0x39, 0x39,
+	0x42, 0x42, 0x4A, 0x4A, 0x4B, 0x4B, 0x4C, 0x4C, 0x49, 0x49, 0x3D, 0x3D, 0x3D, 0x3D, 0x39, 0x39, 0x42, 0x42, 0x4A, 0x4A, 0x4B, 0x4B, 0x4C, 0x4C,
+	0x28, 0x28, 0x25, 0x25, 0x1A, 0x1A, 0x1B, 0x1B, 0x1B, 0x1B, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x28, 0x28, 0x25, 0x25, 0x1A, 0x1A, 0x1B, 0x1B,
+	0x1B, 0x1B, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x28, 0x28, 0x1A, 0x1A, 0x1A, 0x1A, 0x1B, 0x1B, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x22, 0x22,
+	0x28, 0x28, 0x1A, 0x1A, 0x1A, 0x1A, 0x1B, 0x1B, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x22, 0x22, 0x27, 0x27, 0x1C, 0x1C, 0x1A, 0x1A, 0x1B, 0x1B,
+	0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x22, 0x22, 0x27, 0x27, 0x1C, 0x1C, 0x1A, 0x1A, 0x1B, 0x1B, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x22, 0x22,
+	0x27, 0x27, 0x25, 0x25, 0x1A, 0x1A, 0x27, 0x27, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x22, 0x22, 0x27, 0x27, 0x25, 0x25, 0x1A, 0x1A, 0x27, 0x27,
+	0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x22, 0x22, 0x2B, 0x2B, 0x2C, 0x2C, 0x2D, 0x2D, 0x2E, 0x2E, 0x2A, 0x2A, 0x1B, 0x1B, 0x13, 0x13, 0x1B, 0x1B,
+	0x2B, 0x2B, 0x2C, 0x2C, 0x2D, 0x2D, 0x2E, 0x2E, 0x2A, 0x2A, 0x1B, 0x1B, 0x13, 0x13, 0x1B, 0x1B, 0x36, 0x36, 0x37, 0x37, 0x38, 0x38, 0x39, 0x39,
+	0x3A, 0x3A, 0x2F, 0x2F, 0x31, 0x31, 0x27, 0x27, 0x36, 0x36, 0x37, 0x37, 0x38, 0x38, 0x39, 0x39, 0x3A, 0x3A, 0x2F, 0x2F, 0x31, 0x31, 0x27, 0x27,
+	0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x44, 0x44, 0x38, 0x38, 0x37, 0x37, 0x32, 0x32, 0x32, 0x32, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x44, 0x44,
+	0x38, 0x38, 0x37, 0x37, 0x32, 0x32, 0x32, 0x32, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x48, 0x48, 0x43, 0x43, 0x43, 0x43, 0x4D, 0x4D, 0x4D, 0x4D,
+	0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x48, 0x48, 0x43, 0x43, 0x43, 0x43, 0x4D, 0x4D, 0x4D, 0x4D, 0x1B, 0x1B, 0x1B, 0x1B, 0x1A, 0x1A, 0x1C, 0x1C,
+	0x1B, 0x1B, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x1B, 0x1B, 0x1B, 0x1B, 0x1A, 0x1A, 0x1C, 0x1C, 0x1B, 0x1B, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13,
+	0x13, 0x13, 0x1B, 0x1B, 0x1A, 0x1A, 0x1C, 0x1C, 0x1B, 0x1B, 0x1B, 0x1B, 0x22, 0x22, 0x1B, 0x1B, 0x13, 0x13, 0x1B, 0x1B, 0x1A, 0x1A, 0x1C, 0x1C,
+	0x1B, 0x1B, 0x1B, 0x1B, 0x22, 0x22, 0x1B, 0x1B, 0x13, 0x13, 0x1B, 0x1B, 0x1A, 0x1A, 0x1C, 0x1C, 0x1B, 0x1B, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13,
+	0x13, 0x13, 0x1B, 0x1B, 0x1A, 0x1A, 0x1C, 0x1C, 0x1B, 0x1B, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x1B, 0x1B, 0x27, 0x27, 0x1A, 0x1A, 0x1C, 0x1C,
+	0x27, 0x27, 0x13, 0x13, 0x1B, 0x1B, 0x13, 0x13, 0x1B, 0x1B, 0x27, 0x27, 0x1A, 0x1A, 0x1C, 0x1C, 0x27, 0x27, 0x13, 0x13, 0x1B, 0x1B, 0x13, 0x13,
+	0x1C, 0x1C, 0x27, 0x27, 0x2D, 0x2D, 0x2C, 0x2C, 0x2F, 0x2F, 0x2B, 0x2B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1C, 0x1C, 0x27, 0x27, 0x2D, 0x2D, 0x2C, 0x2C,
+	0x2F, 0x2F, 0x2B, 0x2B, 0x1B, 0x1B, 0x1B, 0x1B, 0x2D, 0x2D, 0x32, 0x32, 0x39, 0x39, 0x37, 0x37, 0x37, 0x37, 0x36, 0x36, 0x2F, 0x2F, 0x33, 0x33,
+	0x2D, 0x2D, 0x32, 0x32, 0x39, 0x39, 0x37, 0x37, 0x37, 0x37, 0x36, 0x36, 0x2F, 0x2F, 0x33, 0x33, 0x37, 0x37, 0x38, 0x38, 0x44, 0x44, 0x43, 0x43,
+	0x43, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x38, 0x38, 0x44, 0x44, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x37,
+	0x43, 0x43, 0x43, 0x43, 0x4C, 0x4C, 0x4C, 0x4C, 0x4E, 0x4E, 0x4C, 0x4C, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x4C, 0x4C, 0x4C, 0x4C,
+	0x4E, 0x4E, 0x4C, 0x4C, 0x43, 0x43, 0x43, 0x43, 0x1B, 0x1B, 0x14, 0x14, 0x1F, 0x1F, 0x1E, 0x1E, 0x11, 0x11, 0x19, 0x19, 0x1D, 0x1D, 0x21, 0x21,
+	0x1B, 0x1B, 0x14, 0x14, 0x1F, 0x1F, 0x1E, 0x1E, 0x11, 0x11, 0x19, 0x19, 0x1D, 0x1D, 0x21, 0x21, 0x1B, 0x1B, 0x14, 0x14, 0x1F, 0x1F, 0x1E, 0x1E,
+	0x11, 0x11, 0x19, 0x19, 0x1D, 0x1D, 0x21, 0x21, 0x1B, 0x1B, 0x14, 0x14, 0x1F, 0x1F, 0x1E, 0x1E, 0x11, 0x11, 0x19, 0x19, 0x1D, 0x1D, 0x21, 0x21,
+	0x1B, 0x1B, 0x14, 0x14, 0x1F, 0x1F, 0x1E, 0x1E, 0x11, 0x11, 0x1D, 0x1D, 0x1D, 0x1D, 0x21, 0x21, 0x1B, 0x1B, 0x14, 0x14, 0x1F, 0x1F, 0x1E, 0x1E,
+	0x11, 0x11, 0x1D, 0x1D, 0x1D, 0x1D, 0x21, 0x21, 0x1B, 0x1B, 0x14, 0x14, 0x21, 0x21, 0x1F, 0x1F, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x21, 0x21,
+	0x1B, 0x1B, 0x14, 0x14, 0x21, 0x21, 0x1F, 0x1F, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x21, 0x21, 0x1B, 0x1B, 0x14, 0x14, 0x21, 0x21, 0x21, 0x21,
+	0x1D, 0x1D, 0x1D, 0x1D, 0x30, 0x30, 0x21, 0x21, 0x1B, 0x1B, 0x14, 0x14, 0x21, 0x21, 0x21, 0x21, 0x1D, 0x1D, 0x1D, 0x1D, 0x30, 0x30, 0x21, 0x21,
+	0x27, 0x27, 0x1A, 0x1A, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1B, 0x1B, 0x27, 0x27, 0x1A, 0x1A, 0x21, 0x21, 0x21, 0x21,
+	0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1B, 0x1B, 0x32, 0x32, 0x2D, 0x2D, 0x45, 0x45, 0x16, 0x16, 0x1B, 0x1B, 0x1B, 0x1B, 0x34, 0x34, 0x3B, 0x3B,
+	0x32, 0x32, 0x2D, 0x2D, 0x45, 0x45, 0x16, 0x16, 0x1B, 0x1B, 0x1B, 0x1B, 0x34, 0x34, 0x3B, 0x3B, 0x42, 0x42, 0x40, 0x40, 0x3A, 0x3A, 0x34, 0x34,
+	0x3B, 0x3B, 0x36, 0x36, 0x37, 0x37, 0x4F, 0x4F, 0x42, 0x42, 0x40, 0x40, 0x3A, 0x3A, 0x34, 0x34, 0x3B, 0x3B, 0x36, 0x36, 0x37, 0x37, 0x4F, 0x4F,
+	0x21, 0x21, 0x14, 0x14, 0x1C, 0x1C, 0x1B, 0x1B, 0x13, 0x13, 0x1B, 0x1B, 0x13, 0x13, 0x1B, 0x1B, 0x21, 0x21, 0x14, 0x14, 0x1C, 0x1C, 0x1B, 0x1B,
+	0x13, 0x13, 0x1B, 0x1B, 0x13, 0x13, 0x1B, 0x1B, 0x21, 0x21, 0x14, 0x14, 0x1B, 0x1B, 0x1B, 0x1B, 0x22, 0x22, 0x1B, 0x1B, 0x1B, 0x1B, 0x1A, 0x1A,
+	0x21, 0x21, 0x14, 0x14, 0x1B, 0x1B, 0x1B, 0x1B, 0x22, 0x22, 0x1B, 0x1B, 0x1B, 0x1B, 0x1A, 0x1A, 0x21, 0x21, 0x14, 0x14, 0x1C, 0x1C, 0x1B, 0x1B,
+	0x13, 0x13, 0x1B, 0x1B, 0x1C, 0x1C, 0x1A, 0x1A, 0x21, 0x21, 0x14, 0x14, 0x1C, 0x1C, 0x1B, 0x1B, 0x13, 0x13, 0x1B, 0x1B, 0x1C, 0x1C, 0x1A, 0x1A,
+	0x21, 0x21, 0x1A, 0x1A, 0x1C, 0x1C, 0x27, 0x27, 0x13, 0x13, 0x1B, 0x1B, 0x1C, 0x1C, 0x1A, 0x1A, 0x21, 0x21, 0x1A, 0x1A, 0x1C, 0x1C, 0x27, 0x27,
+	0x13, 0x13, 0x1B, 0x1B, 0x1C, 0x1C, 0x1A, 0x1A, 0x16, 0x16, 0x31, 0x31, 0x32, 0x32, 0x2B, 0x2B, 0x2B, 0x2B, 0x27, 0x27, 0x27, 0x27, 0x1A, 0x1A,
+	0x16, 0x16, 0x31, 0x31, 0x32, 0x32, 0x2B, 0x2B, 0x2B, 0x2B, 0x27, 0x27, 0x27, 0x27, 0x1A, 0x1A, 0x34, 0x34, 0x3B, 0x3B, 0x37, 0x37, 0x37, 0x37,
+	0x36, 0x36, 0x32, 0x32, 0x2C, 0x2C, 0x3C, 0x3C, 0x34, 0x34, 0x3B, 0x3B, 0x37, 0x37, 0x37, 0x37, 0x36, 0x36, 0x32, 0x32, 0x2C, 0x2C, 0x3C, 0x3C,
+	0x37, 0x37, 0x44, 0x44, 0x43, 0x43, 0x3F, 0x3F, 0x46, 0x46, 0x38, 0x38, 0x42, 0x42, 0x42, 0x42, 0x37, 0x37, 0x44, 0x44, 0x43, 0x43, 0x3F, 0x3F,
+	0x46, 0x46, 0x38, 0x38, 0x42, 0x42, 0x42, 0x42, 0x43, 0x43, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x48, 0x48, 0x4C, 0x4C, 0x4C, 0x4C, 0x4B, 0x4B,
+	0x43, 0x43, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x48, 0x48, 0x4C, 0x4C, 0x4C, 0x4C, 0x4B, 0x4B, 0x1C, 0x1C, 0x1C, 0x1C, 0x28, 0x28, 0x25, 0x25,
+	0x1A, 0x1A, 0x1B, 0x1B, 0x1B, 0x1B, 0x22, 0x22, 0x1C, 0x1C, 0x1C, 0x1C, 0x28, 0x28, 0x25, 0x25, 0x1A, 0x1A, 0x1B, 0x1B, 0x1B, 0x1B, 0x22, 0x22,
+	0x1A, 0x1A, 0x1A, 0x1A, 0x28, 0x28, 0x1A, 0x1A, 0x1A, 0x1A, 0x1B, 0x1B, 0x13, 0x13, 0x22, 0x22, 0x1A, 0x1A, 0x1A, 0x1A, 0x28, 0x28, 0x1A, 0x1A,
+	0x1A, 0x1A, 0x1B, 0x1B, 0x13, 0x13, 0x22, 0x22, 0x17, 0x17, 0x27, 0x27, 0x27, 0x27, 0x1C, 0x1C, 0x1A, 0x1A, 0x1B, 0x1B, 0x13, 0x13, 0x22, 0x22,
+	0x17, 0x17, 0x27, 0x27, 0x27, 0x27, 0x1C, 0x1C, 0x1A, 0x1A, 0x1B, 0x1B, 0x13, 0x13, 0x22, 0x22, 0x27, 0x27, 0x1C, 0x1C, 0x27, 0x27, 0x25, 0x25,
+	0x1A, 0x1A, 0x27, 0x27, 0x1B, 0x1B, 0x22, 0x22, 0x27, 0x27, 0x1C, 0x1C, 0x27, 0x27, 0x25, 0x25, 0x1A, 0x1A, 0x27, 0x27, 0x1B, 0x1B, 0x22, 0x22,
+	0x27, 0x27, 0x33, 0x33, 0x32, 0x32, 0x2C, 0x2C, 0x2D, 0x2D, 0x27, 0x27, 0x1C, 0x1C, 0x1B, 0x1B, 0x27, 0x27, 0x33, 0x33, 0x32, 0x32, 0x2C, 0x2C,
+	0x2D, 0x2D, 0x27, 0x27, 0x1C, 0x1C, 0x1B, 0x1B, 0x3D, 0x3D, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x39, 0x39, 0x32, 0x32, 0x33, 0x33, 0x27, 0x27,
+	0x3D, 0x3D, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x39, 0x39, 0x32, 0x32, 0x33, 0x33, 0x27, 0x27, 0x42, 0x42, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+	0x44, 0x44, 0x37, 0x37, 0x37, 0x37, 0x32, 0x32, 0x42, 0x42, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x44, 0x44, 0x37, 0x37, 0x37, 0x37, 0x32, 0x32,
+	0x50, 0x50, 0x4C, 0x4C, 0x4C, 0x4C, 0x48, 0x48, 0x4C, 0x4C, 0x43, 0x43, 0x43, 0x43, 0x51, 0x51, 0x50, 0x50, 0x4C, 0x4C, 0x4C, 0x4C, 0x48, 0x48,
+	0x4C, 0x4C, 0x43, 0x43, 0x43, 0x43, 0x51, 0x51, 0x22, 0x22, 0x22, 0x22, 0x1B, 0x1B, 0x1B, 0x1B, 0x1A, 0x1A, 0x13, 0x13, 0x1B, 0x1B, 0x13, 0x13,
+	0x22, 0x22, 0x22, 0x22, 0x1B, 0x1B, 0x1B, 0x1B, 0x1A, 0x1A, 0x13, 0x13, 0x1B, 0x1B, 0x13, 0x13, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x1B, 0x1B,
+	0x1A, 0x1A, 0x13, 0x13, 0x1B, 0x1B, 0x1B, 0x1B, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x1B, 0x1B, 0x1A, 0x1A, 0x13, 0x13, 0x1B, 0x1B, 0x1B, 0x1B,
+	0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x1B, 0x1B, 0x1A, 0x1A, 0x13, 0x13, 0x1B, 0x1B, 0x13, 0x13, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x1B, 0x1B,
+	0x1A, 0x1A, 0x13, 0x13, 0x1B, 0x1B, 0x13, 0x13, 0x22, 0x22, 0x22, 0x22, 0x1B, 0x1B, 0x1B, 0x1B, 0x1A, 0x1A, 0x1C, 0x1C, 0x1B, 0x1B, 0x13, 0x13,
+	0x22, 0x22, 0x22, 0x22, 0x1B, 0x1B, 0x1B, 0x1B, 0x1A, 0x1A, 0x1C, 0x1C, 0x1B, 0x1B, 0x13, 0x13, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x1B, 0x1B,
+	0x1A, 0x1A, 0x1C, 0x1C, 0x1B, 0x1B, 0x1B, 0x1B, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x1B, 0x1B, 0x1A, 0x1A, 0x1C, 0x1C, 0x1B, 0x1B, 0x1B, 0x1B,
+	0x13, 0x13, 0x1B, 0x1B, 0x1C, 0x1C, 0x27, 0x27, 0x1A, 0x1A, 0x1A, 0x1A, 0x17, 0x17, 0x14, 0x14, 0x13, 0x13, 0x1B, 0x1B, 0x1C, 0x1C, 0x27, 0x27,
+	0x1A, 0x1A, 0x1A, 0x1A, 0x17, 0x17, 0x14, 0x14, 0x2B, 0x2B, 0x27, 0x27, 0x27, 0x27, 0x2E, 0x2E, 0x2D, 0x2D, 0x28, 0x28, 0x27, 0x27, 0x1A, 0x1A,
+	0x2B, 0x2B, 0x27, 0x27, 0x27, 0x27, 0x2E, 0x2E, 0x2D, 0x2D, 0x28, 0x28, 0x27, 0x27, 0x1A, 0x1A, 0x37, 0x37, 0x32, 0x32, 0x3A, 0x3A, 0x39, 0x39,
+	0x39, 0x39, 0x41, 0x41, 0x32, 0x32, 0x32, 0x32, 0x37, 0x37, 0x32, 0x32, 0x3A, 0x3A, 0x39, 0x39, 0x39, 0x39, 0x41, 0x41, 0x32, 0x32, 0x32, 0x32,
+	0x22, 0x22, 0x13, 0x13, 0x1B, 0x1B, 0x14, 0x14, 0x21, 0x21, 0x1E, 0x1E, 0x19, 0x19, 0x11, 0x11, 0x22, 0x22, 0x13, 0x13, 0x1B, 0x1B, 0x14, 0x14,
+	0x21, 0x21, 0x1E, 0x1E, 0x19, 0x19, 0x11, 0x11, 0x22, 0x22, 0x1B, 0x1B, 0x1B, 0x1B, 0x14, 0x14, 0x21, 0x21, 0x1F, 0x1F, 0x19, 0x19, 0x11, 0x11,
+	0x22, 0x22, 0x1B, 0x1B, 0x1B, 0x1B, 0x14, 0x14, 0x21, 0x21, 0x1F, 0x1F, 0x19, 0x19, 0x11, 0x11, 0x22, 0x22, 0x13, 0x13, 0x1B, 0x1B, 0x14, 0x14,
+	0x21, 0x21, 0x1F, 0x1F, 0x1D, 0x1D, 0x11, 0x11, 0x22, 0x22, 0x13, 0x13, 0x1B, 0x1B, 0x14, 0x14, 0x21, 0x21, 0x1F, 0x1F, 0x1D, 0x1D, 0x11, 0x11,
+	0x22, 0x22, 0x13, 0x13, 0x1B, 0x1B, 0x14, 0x14, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x22, 0x22, 0x13, 0x13, 0x1B, 0x1B, 0x14, 0x14,
+	0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x24, 0x24, 0x16, 0x16, 0x16, 0x16, 0x1B, 0x1B, 0x1B, 0x1B,
+	0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x24, 0x24, 0x16, 0x16, 0x16, 0x16, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1A, 0x1A, 0x27, 0x27, 0x1A, 0x1A,
+	0x34, 0x34, 0x34, 0x34, 0x35, 0x35, 0x36, 0x36, 0x1B, 0x1B, 0x1A, 0x1A, 0x27, 0x27, 0x1A, 0x1A, 0x34, 0x34, 0x34, 0x34, 0x35, 0x35, 0x36, 0x36,
+	0x27, 0x27, 0x1A, 0x1A, 0x2E, 0x2E, 0x3C, 0x3C, 0x39, 0x39, 0x37, 0x37, 0x3E, 0x3E, 0x3F, 0x3F, 0x27, 0x27, 0x1A, 0x1A, 0x2E, 0x2E, 0x3C, 0x3C,
+	0x39, 0x39, 0x37, 0x37, 0x3E, 0x3E, 0x3F, 0x3F, 0x2B, 0x2B, 0x32, 0x32, 0x39, 0x39, 0x38, 0x38, 0x44, 0x44, 0x3F, 0x3F, 0x48, 0x48, 0x48, 0x48,
+	0x2B, 0x2B, 0x32, 0x32, 0x39, 0x39, 0x38, 0x38, 0x44, 0x44, 0x3F, 0x3F, 0x48, 0x48, 0x48, 0x48, 0x19, 0x19, 0x1D, 0x1D, 0x21, 0x21, 0x21, 0x21,
+	0x14, 0x14, 0x1C, 0x1C, 0x1B, 0x1B, 0x13, 0x13, 0x19, 0x19, 0x1D, 0x1D, 0x21, 0x21, 0x21, 0x21, 0x14, 0x14, 0x1C, 0x1C, 0x1B, 0x1B, 0x13, 0x13,
+	0x19, 0x19, 0x1D, 0x1D, 0x21, 0x21, 0x21, 0x21, 0x14, 0x14, 0x1B, 0x1B, 0x1B, 0x1B, 0x22, 0x22, 0x19, 0x19, 0x1D, 0x1D, 0x21, 0x21, 0x21, 0x21,
+	0x14, 0x14, 0x1B, 0x1B, 0x1B, 0x1B, 0x22, 0x22, 0x1D, 0x1D, 0x1D, 0x1D, 0x21, 0x21, 0x21, 0x21, 0x14, 0x14, 0x1C, 0x1C, 0x1B, 0x1B, 0x13, 0x13,
+	0x1D, 0x1D, 0x1D, 0x1D, 0x21, 0x21, 0x21, 0x21, 0x14, 0x14, 0x1C, 0x1C, 0x1B, 0x1B, 0x13, 0x13, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21,
+	0x24, 0x24, 0x1C, 0x1C, 0x1B, 0x1B, 0x13, 0x13, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x24, 0x24, 0x1C, 0x1C, 0x1B, 0x1B, 0x13, 0x13,
+	0x1B, 0x1B, 0x1B, 0x1B, 0x16, 0x16, 0x16, 0x16, 0x1A, 0x1A, 0x17, 0x17, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x16, 0x16, 0x16, 0x16,
+	0x1A, 0x1A, 0x17, 0x17, 0x1B, 0x1B, 0x1B, 0x1B, 0x36, 0x36, 0x35, 0x35, 0x34, 0x34, 0x34, 0x34, 0x28, 0x28, 0x1A, 0x1A, 0x27, 0x27, 0x1A, 0x1A,
+	0x36, 0x36, 0x35, 0x35, 0x34, 0x34, 0x34, 0x34, 0x28, 0x28, 0x1A, 0x1A, 0x27, 0x27, 0x1A, 0x1A, 0x3F, 0x3F, 0x3E, 0x3E, 0x37, 0x37, 0x40, 0x40,
+	0x41, 0x41, 0x41, 0x41, 0x2E, 0x2E, 0x2D, 0x2D, 0x3F, 0x3F, 0x3E, 0x3E, 0x37, 0x37, 0x40, 0x40, 0x41, 0x41, 0x41, 0x41, 0x2E, 0x2E, 0x2D, 0x2D,
+	0x48, 0x48, 0x48, 0x48, 0x43, 0x43, 0x44, 0x44, 0x42, 0x42, 0x49, 0x49, 0x3D, 0x3D, 0x3D, 0x3D, 0x48, 0x48, 0x48, 0x48, 0x43, 0x43, 0x44, 0x44,
+	0x42, 0x42, 0x49, 0x49, 0x3D, 0x3D, 0x3D, 0x3D, 0x1B, 0x1B, 0x13, 0x13, 0x1B, 0x1B, 0x1C, 0x1C, 0x1C, 0x1C, 0x28, 0x28, 0x25, 0x25, 0x1A, 0x1A,
+	0x1B, 0x1B, 0x13, 0x13, 0x1B, 0x1B, 0x1C, 0x1C, 0x1C, 0x1C, 0x28, 0x28, 0x25, 0x25, 0x1A, 0x1A, 0x1B, 0x1B, 0x1B, 0x1B, 0x1A, 0x1A, 0x1A, 0x1A,
+	0x1A, 0x1A, 0x28, 0x28, 0x1A, 0x1A, 0x1A, 0x1A, 0x1B, 0x1B, 0x1B, 0x1B, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x28, 0x28, 0x1A, 0x1A, 0x1A, 0x1A,
+	0x1B, 0x1B, 0x1C, 0x1C, 0x1A, 0x1A, 0x17, 0x17, 0x27, 0x27, 0x27, 0x27, 0x1C, 0x1C, 0x1A, 0x1A, 0x1B, 0x1B, 0x1C, 0x1C, 0x1A, 0x1A, 0x17, 0x17,
+	0x27, 0x27, 0x27, 0x27, 0x1C, 0x1C, 0x1A, 0x1A, 0x1B, 0x1B, 0x1C, 0x1C, 0x1A, 0x1A, 0x27, 0x27, 0x1C, 0x1C, 0x27, 0x27, 0x25, 0x25, 0x1A, 0x1A,
+	0x1B, 0x1B, 0x1C, 0x1C, 0x1A, 0x1A, 0x27, 0x27, 0x1C, 0x1C, 0x27, 0x27, 0x25, 0x25, 0x1A, 0x1A, 0x1B, 0x1B, 0x17, 0x17, 0x1A, 0x1A, 0x27, 0x27,
+	0x2A, 0x2A, 0x2B, 0x2B, 0x2C, 0x2C, 0x2D, 0x2D, 0x1B, 0x1B, 0x17, 0x17, 0x1A, 0x1A, 0x27, 0x27, 0x2A, 0x2A, 0x2B, 0x2B, 0x2C, 0x2C, 0x2D, 0x2D,
+	0x27, 0x27, 0x28, 0x28, 0x28, 0x28, 0x32, 0x32, 0x32, 0x32, 0x36, 0x36, 0x37, 0x37, 0x38, 0x38, 0x27, 0x27, 0x28, 0x28, 0x28, 0x28, 0x32, 0x32,
+	0x32, 0x32, 0x36, 0x36, 0x37, 0x37, 0x38, 0x38, 0x2E, 0x2E, 0x41, 0x41, 0x41, 0x41, 0x40, 0x40, 0x42, 0x42, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
+	0x2E, 0x2E, 0x41, 0x41, 0x41, 0x41, 0x40, 0x40, 0x42, 0x42, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x39, 0x39, 0x42, 0x42, 0x4A, 0x4A, 0x4B, 0x4B,
+	0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x39, 0x39, 0x42, 0x42, 0x4A, 0x4A, 0x4B, 0x4B, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C,
+	0x1B, 0x1B, 0x1B, 0x1B, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x1B, 0x1B, 0x1B, 0x1B, 0x1A, 0x1A, 0x1B, 0x1B, 0x1B, 0x1B, 0x22, 0x22, 0x22, 0x22,
+	0x22, 0x22, 0x1B, 0x1B, 0x1B, 0x1B, 0x1A, 0x1A, 0x1B, 0x1B, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x1B, 0x1B, 0x1A, 0x1A,
+	0x1B, 0x1B, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x1B, 0x1B, 0x1A, 0x1A, 0x1B, 0x1B, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13,
+	0x22, 0x22, 0x13, 0x13, 0x1B, 0x1B, 0x1A, 0x1A, 0x1B, 0x1B, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x1B, 0x1B, 0x1A, 0x1A,
+	0x27, 0x27, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x22, 0x22, 0x1B, 0x1B, 0x27, 0x27, 0x1A, 0x1A, 0x27, 0x27, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
+	0x22, 0x22, 0x1B, 0x1B, 0x27, 0x27, 0x1A, 0x1A, 0x2E, 0x2E, 0x2A, 0x2A, 0x1B, 0x1B, 0x13, 0x13, 0x1B, 0x1B, 0x1C, 0x1C, 0x27, 0x27, 0x2D, 0x2D,
+	0x2E, 0x2E, 0x2A, 0x2A, 0x1B, 0x1B, 0x13, 0x13, 0x1B, 0x1B, 0x1C, 0x1C, 0x27, 0x27, 0x2D, 0x2D, 0x39, 0x39, 0x3A, 0x3A, 0x2F, 0x2F, 0x31, 0x31,
+	0x27, 0x27, 0x2D, 0x2D, 0x32, 0x32, 0x39, 0x39, 0x39, 0x39, 0x3A, 0x3A, 0x2F, 0x2F, 0x31, 0x31, 0x27, 0x27, 0x2D, 0x2D, 0x32, 0x32, 0x39, 0x39,
+	0x44, 0x44, 0x38, 0x38, 0x37, 0x37, 0x32, 0x32, 0x32, 0x32, 0x37, 0x37, 0x38, 0x38, 0x44, 0x44, 0x44, 0x44, 0x38, 0x38, 0x37, 0x37, 0x32, 0x32,
+	0x32, 0x32, 0x37, 0x37, 0x38, 0x38, 0x44, 0x44, 0x48, 0x48, 0x43, 0x43, 0x43, 0x43, 0x4D, 0x4D, 0x4D, 0x4D, 0x43, 0x43, 0x43, 0x43, 0x4C, 0x4C,
+	0x48, 0x48, 0x43, 0x43, 0x43, 0x43, 0x4D, 0x4D, 0x4D, 0x4D, 0x43, 0x43, 0x43, 0x43, 0x4C, 0x4C, 0x1C, 0x1C, 0x1B, 0x1B, 0x13, 0x13, 0x22, 0x22,
+	0x13, 0x13, 0x1B, 0x1B, 0x14, 0x14, 0x1F, 0x1F, 0x1C, 0x1C, 0x1B, 0x1B, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x1B, 0x1B, 0x14, 0x14, 0x1F, 0x1F,
+	0x1C, 0x1C, 0x1B, 0x1B, 0x1B, 0x1B, 0x22, 0x22, 0x1B, 0x1B, 0x1B, 0x1B, 0x14, 0x14, 0x1F, 0x1F, 0x1C, 0x1C, 0x1B, 0x1B, 0x1B, 0x1B, 0x22, 0x22,
+	0x1B, 0x1B, 0x1B, 0x1B, 0x14, 0x14, 0x1F, 0x1F, 0x1C, 0x1C, 0x1B, 0x1B, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x1B, 0x1B, 0x14, 0x14, 0x1F, 0x1F,
+	0x1C, 0x1C, 0x1B, 0x1B, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x1B, 0x1B, 0x14, 0x14, 0x1F, 0x1F, 0x1C, 0x1C, 0x27, 0x27, 0x13, 0x13, 0x1B, 0x1B,
+	0x13, 0x13, 0x1B, 0x1B, 0x14, 0x14, 0x21, 0x21, 0x1C, 0x1C, 0x27, 0x27, 0x13, 0x13, 0x1B, 0x1B, 0x13, 0x13, 0x1B, 0x1B, 0x14, 0x14, 0x21, 0x21,
+	0x2C, 0x2C, 0x2F, 0x2F, 0x2B, 0x2B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x14, 0x14, 0x21, 0x21, 0x2C, 0x2C, 0x2F, 0x2F, 0x2B, 0x2B, 0x1B, 0x1B,
+	0x1B, 0x1B, 0x1B, 0x1B, 0x14, 0x14, 0x21, 0x21, 0x37, 0x37, 0x37, 0x37, 0x36, 0x36, 0x2F, 0x2F, 0x33, 0x33, 0x27, 0x27, 0x1A, 0x1A, 0x21, 0x21,
+	0x37, 0x37, 0x37, 0x37, 0x36, 0x36, 0x2F, 0x2F, 0x33, 0x33, 0x27, 0x27, 0x1A, 0x1A, 0x21, 0x21, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x37, 0x37,
+	0x37, 0x37, 0x32, 0x32, 0x2D, 0x2D, 0x45, 0x45, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x37, 0x37, 0x37, 0x37, 0x32, 0x32, 0x2D, 0x2D, 0x45, 0x45,
+	0x4C, 0x4C, 0x4E, 0x4E, 0x4C, 0x4C, 0x43, 0x43, 0x43, 0x43, 0x42, 0x42, 0x40, 0x40, 0x3A, 0x3A, 0x4C, 0x4C, 0x4E, 0x4E, 0x4C, 0x4C, 0x43, 0x43,
+	0x43, 0x43, 0x42, 0x42, 0x40, 0x40, 0x3A, 0x3A, 0x1E, 0x1E, 0x11, 0x11, 0x19, 0x19, 0x1D, 0x1D, 0x21, 0x21, 0x21, 0x21, 0x14, 0x14, 0x1C, 0x1C,
+	0x1E, 0x1E, 0x11, 0x11, 0x19, 0x19, 0x1D, 0x1D, 0x21, 0x21, 0x21, 0x21, 0x14, 0x14, 0x1C, 0x1C, 0x1E, 0x1E, 0x11, 0x11, 0x19, 0x19, 0x1D, 0x1D,
+	0x21, 0x21, 0x21, 0x21, 0x14, 0x14, 0x1B, 0x1B, 0x1E, 0x1E, 0x11, 0x11, 0x19, 0x19, 0x1D, 0x1D, 0x21, 0x21, 0x21, 0x21, 0x14, 0x14, 0x1B, 0x1B,
+	0x1E, 0x1E, 0x11, 0x11, 0x1D, 0x1D, 0x1D, 0x1D, 0x21, 0x21, 0x21, 0x21, 0x14, 0x14, 0x1C, 0x1C, 0x1E, 0x1E, 0x11, 0x11, 0x1D, 0x1D, 0x1D, 0x1D,
+	0x21, 0x21, 0x21, 0x21, 0x14, 0x14, 0x1C, 0x1C, 0x1F, 0x1F, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x21, 0x21, 0x21, 0x21, 0x1A, 0x1A, 0x1C, 0x1C,
+	0x1F, 0x1F, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x1D, 0x21, 0x21, 0x21, 0x21, 0x1A, 0x1A, 0x1C, 0x1C, 0x21, 0x21, 0x1D, 0x1D, 0x1D, 0x1D, 0x30, 0x30,
+	0x21, 0x21, 0x16, 0x16, 0x31, 0x31, 0x32, 0x32, 0x21, 0x21, 0x1D, 0x1D, 0x1D, 0x1D, 0x30, 0x30, 0x21, 0x21, 0x16, 0x16, 0x31, 0x31, 0x32, 0x32,
+	0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x1B, 0x1B, 0x34, 0x34, 0x3B, 0x3B, 0x37, 0x37, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21,
+	0x1B, 0x1B, 0x34, 0x34, 0x3B, 0x3B, 0x37, 0x37, 0x16, 0x16, 0x1B, 0x1B, 0x1B, 0x1B, 0x34, 0x34, 0x3B, 0x3B, 0x37, 0x37, 0x44, 0x44, 0x43, 0x43,
+	0x16, 0x16, 0x1B, 0x1B, 0x1B, 0x1B, 0x34, 0x34, 0x3B, 0x3B, 0x37, 0x37, 0x44, 0x44, 0x43, 0x43, 0x34, 0x34, 0x3B, 0x3B, 0x36, 0x36, 0x37, 0x37,
+	0x4F, 0x4F, 0x43, 0x43, 0x4C, 0x4C, 0x4C, 0x4C, 0x34, 0x34, 0x3B, 0x3B, 0x36, 0x36, 0x37, 0x37, 0x4F, 0x4F, 0x43, 0x43, 0x4C, 0x4C, 0x4C, 0x4C,
+	0x1B, 0x1B, 0x13, 0x13, 0x1B, 0x1B, 0x13, 0x13, 0x1B, 0x1B, 0x1C, 0x1C, 0x1C, 0x1C, 0x28, 0x28, 0x1B, 0x1B, 0x13, 0x13, 0x1B, 0x1B, 0x13, 0x13,
+	0x1B, 0x1B, 0x1C, 0x1C, 0x1C, 0x1C, 0x28, 0x28, 0x1B, 0x1B, 0x22, 0x22, 0x1B, 0x1B, 0x1B, 0x1B, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x28, 0x28,
+	0x1B, 0x1B, 0x22, 0x22, 0x1B, 0x1B, 0x1B, 0x1B, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x28, 0x28, 0x1B, 0x1B, 0x13, 0x13, 0x1B, 0x1B, 0x1C, 0x1C,
+	0x1A, 0x1A, 0x17, 0x17, 0x27, 0x27, 0x27, 0x27, 0x1B, 0x1B, 0x13, 0x13, 0x1B, 0x1B, 0x1C, 0x1C, 0x1A, 0x1A, 0x17, 0x17, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x13, 0x13, 0x1B, 0x1B, 0x1C, 0x1C, 0x1A, 0x1A, 0x27, 0x27, 0x1C, 0x1C, 0x27, 0x27, 0x27, 0x27, 0x13, 0x13, 0x1B, 0x1B, 0x1C, 0x1C,
+	0x1A, 0x1A, 0x27, 0x27, 0x1C, 0x1C, 0x27, 0x27, 0x2B, 0x2B, 0x2B, 0x2B, 0x27, 0x27, 0x27, 0x27, 0x1A, 0x1A, 0x27, 0x27, 0x33, 0x33, 0x32, 0x32,
+	0x2B, 0x2B, 0x2B, 0x2B, 0x27, 0x27, 0x27, 0x27, 0x1A, 0x1A, 0x27, 0x27, 0x33, 0x33, 0x32, 0x32, 0x37, 0x37, 0x36, 0x36, 0x32, 0x32, 0x2C, 0x2C,
+	0x3C, 0x3C, 0x3D, 0x3D, 0x37, 0x37, 0x37, 0x37, 0x37, 0x37, 0x36, 0x36, 0x32, 0x32, 0x2C, 0x2C, 0x3C, 0x3C, 0x3D, 0x3D, 0x37, 0x37, 0x37, 0x37,
+	0x3F, 0x3F, 0x46, 0x46, 0x38, 0x38, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x43, 0x43, 0x43, 0x43, 0x3F, 0x3F, 0x46, 0x46, 0x38, 0x38, 0x42, 0x42,
+	0x42, 0x42, 0x42, 0x42, 0x43, 0x43, 0x43, 0x43, 0x4C, 0x4C, 0x48, 0x48, 0x4C, 0x4C, 0x4C, 0x4C, 0x4B, 0x4B, 0x50, 0x50, 0x4C, 0x4C, 0x4C, 0x4C,
+	0x4C, 0x4C, 0x48, 0x48, 0x4C, 0x4C, 0x4C, 0x4C, 0x4B, 0x4B, 0x50, 0x50, 0x4C, 0x4C, 0x4C, 0x4C, 0x25, 0x25, 0x1A, 0x1A, 0x1B, 0x1B, 0x1B, 0x1B,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x1B, 0x1B, 0x25, 0x25, 0x1A, 0x1A, 0x1B, 0x1B, 0x1B, 0x1B, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x1B, 0x1B,
+	0x1A, 0x1A, 0x1A, 0x1A, 0x1B, 0x1B, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x1A, 0x1A, 0x1A, 0x1A, 0x1B, 0x1B, 0x13, 0x13,
+	0x22, 0x22, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x1C, 0x1C, 0x1A, 0x1A, 0x1B, 0x1B, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13,
+	0x1C, 0x1C, 0x1A, 0x1A, 0x1B, 0x1B, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x25, 0x25, 0x1A, 0x1A, 0x27, 0x27, 0x1B, 0x1B,
+	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x1B, 0x1B, 0x25, 0x25, 0x1A, 0x1A, 0x27, 0x27, 0x1B, 0x1B, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x1B, 0x1B,
+	0x2C, 0x2C, 0x2D, 0x2D, 0x27, 0x27, 0x1C, 0x1C, 0x1B, 0x1B, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x2C, 0x2C, 0x2D, 0x2D, 0x27, 0x27, 0x1C, 0x1C,
+	0x1B, 0x1B, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x37, 0x37, 0x39, 0x39, 0x32, 0x32, 0x33, 0x33, 0x27, 0x27, 0x13, 0x13, 0x1B, 0x1B, 0x1C, 0x1C,
+	0x37, 0x37, 0x39, 0x39, 0x32, 0x32, 0x33, 0x33, 0x27, 0x27, 0x13, 0x13, 0x1B, 0x1B, 0x1C, 0x1C, 0x43, 0x43, 0x44, 0x44, 0x37, 0x37, 0x37, 0x37,
+	0x32, 0x32, 0x2B, 0x2B, 0x27, 0x27, 0x27, 0x27, 0x43, 0x43, 0x44, 0x44, 0x37, 0x37, 0x37, 0x37, 0x32, 0x32, 0x2B, 0x2B, 0x27, 0x27, 0x27, 0x27,
+	0x48, 0x48, 0x4C, 0x4C, 0x43, 0x43, 0x43, 0x43, 0x51, 0x51, 0x37, 0x37, 0x32, 0x32, 0x3A, 0x3A, 0x48, 0x48, 0x4C, 0x4C, 0x43, 0x43, 0x43, 0x43,
+	0x51, 0x51, 0x37, 0x37, 0x32, 0x32, 0x3A, 0x3A, 0x1B, 0x1B, 0x1A, 0x1A, 0x1C, 0x1C, 0x1B, 0x1B, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x1B, 0x1B,
+	0x1B, 0x1B, 0x1A, 0x1A, 0x1C, 0x1C, 0x1B, 0x1B, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x1B, 0x1B, 0x1B, 0x1B, 0x1A, 0x1A, 0x1C, 0x1C, 0x1B, 0x1B,
+	0x1B, 0x1B, 0x22, 0x22, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1A, 0x1A, 0x1C, 0x1C, 0x1B, 0x1B, 0x1B, 0x1B, 0x22, 0x22, 0x1B, 0x1B, 0x1B, 0x1B,
+	0x1B, 0x1B, 0x1A, 0x1A, 0x1C, 0x1C, 0x1B, 0x1B, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x1B, 0x1B, 0x1B, 0x1B, 0x1A, 0x1A, 0x1C, 0x1C, 0x1B, 0x1B,
+	0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x1B, 0x1B, 0x1B, 0x1B, 0x1A, 0x1A, 0x1C, 0x1C, 0x1B, 0x1B, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x1B, 0x1B,
+	0x1B, 0x1B, 0x1A, 0x1A, 0x1C, 0x1C, 0x1B, 0x1B, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x1B, 0x1B, 0x1B, 0x1B, 0x1A, 0x1A, 0x1C, 0x1C, 0x1B, 0x1B,
+	0x1B, 0x1B, 0x22, 0x22, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1A, 0x1A, 0x1C, 0x1C, 0x1B, 0x1B, 0x1B, 0x1B, 0x22, 0x22, 0x1B, 0x1B, 0x1B, 0x1B,
+	0x27, 0x27, 0x1A, 0x1A, 0x1C, 0x1C, 0x1B, 0x1B, 0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x27, 0x27, 0x27, 0x27, 0x1A, 0x1A, 0x1C, 0x1C, 0x1B, 0x1B,
+	0x13, 0x13, 0x22, 0x22, 0x13, 0x13, 0x27, 0x27, 0x2E, 0x2E, 0x2D, 0x2D, 0x33, 0x33, 0x27, 0x27, 0x13, 0x13, 0x1B, 0x1B, 0x2A, 0x2A, 0x2B, 0x2B,
+	0x2E, 0x2E, 0x2D, 0x2D, 0x33, 0x33, 0x27, 0x27, 0x13, 0x13, 0x1B, 0x1B, 0x2A, 0x2A, 0x2B, 0x2B, 0x39, 0x39, 0x39, 0x39, 0x52, 0x52, 0x2F, 0x2F,
+	0x2B, 0x2B, 0x2B, 0x2B, 0x32, 0x32, 0x36, 0x36, 0x39, 0x39, 0x39, 0x39, 0x52, 0x52, 0x2F, 0x2F, 0x2B, 0x2B, 0x2B, 0x2B, 0x32, 0x32, 0x36, 0x36,
+	0x14, 0x14, 0x21, 0x21, 0x1E, 0x1E, 0x19, 0x19, 0x11, 0x11, 0x19, 0x19, 0x1D, 0x1D, 0x21, 0x21, 0x14, 0x14, 0x21, 0x21, 0x1E, 0x1E, 0x19, 0x19,
+	0x11, 0x11, 0x19, 0x19, 0x1D, 0x1D, 0x21, 0x21, 0x14, 0x14, 0x21, 0x21, 0x1F, 0x1F, 0x19, 0x19, 0x11, 0x11, 0x19, 0x19, 0x1D, 0x1D, 0x21, 0x21,
+	0x14, 0x14, 0x21, 0x21, 0x1F, 0x1F, 0x19, 0x19, 0x11, 0x11, 0x19, 0x19, 0x1D, 0x1D, 0x21, 0x21, 0x14, 0x14, 0x21, 0x21, 0x1F, 0x1F, 0x1D, 0x1D,
+	0x11, 0x11, 0x1D, 0x1D, 0x1D, 0x1D, 0x21, 0x21, 0x14, 0x14, 0x21, 0x21, 0x1F, 0x1F, 0x1D, 0x1D, 0x11, 0x11, 0x1D, 0x1D, 0x1D, 0x1D, 0x21, 0x21,
+	0x14, 0x14, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x14, 0x14, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21,
+	0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x24, 0x24, 0x16, 0x16, 0x16, 0x16, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x16, 0x16,
+	0x24, 0x24, 0x16, 0x16, 0x16, 0x16, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x16, 0x16, 0x1A, 0x1A, 0x34, 0x34, 0x34, 0x34, 0x35, 0x35,
+	0x36, 0x36, 0x36, 0x36, 0x35, 0x35, 0x34, 0x34, 0x1A, 0x1A, 0x34, 0x34, 0x34, 0x34, 0x35, 0x35, 0x36, 0x36, 0x36, 0x36, 0x35, 0x35, 0x34, 0x34,
+	0x3C, 0x3C, 0x39, 0x39, 0x37, 0x37, 0x3E, 0x3E, 0x3F, 0x3F, 0x3F, 0x3F, 0x3E, 0x3E, 0x37, 0x37, 0x3C, 0x3C, 0x39, 0x39, 0x37, 0x37, 0x3E, 0x3E,
+	0x3F, 0x3F, 0x3F, 0x3F, 0x3E, 0x3E, 0x37, 0x37, 0x38, 0x38, 0x44, 0x44, 0x3F, 0x3F, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x3F, 0x3F,
+	0x38, 0x38, 0x44, 0x44, 0x3F, 0x3F, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x3F, 0x3F, 0x21, 0x21, 0x14, 0x14, 0x1C, 0x1C, 0x1B, 0x1B,
+	0x13, 0x13, 0x1B, 0x1B, 0x13, 0x13, 0x1B, 0x1B, 0x21, 0x21, 0x14, 0x14, 0x1C, 0x1C, 0x1B, 0x1B, 0x13, 0x13, 0x1B, 0x1B, 0x13, 0x13, 0x1B, 0x1B,
+	0x21, 0x21, 0x14, 0x14, 0x1B, 0x1B, 0x1B, 0x1B, 0x22, 0x22, 0x1B, 0x1B, 0x1B, 0x1B, 0x1A, 0x1A, 0x21, 0x21, 0x14, 0x14, 0x1B, 0x1B, 0x1B, 0x1B,
+	0x22, 0x22, 0x1B, 0x1B, 0x1B, 0x1B, 0x1A, 0x1A, 0x21, 0x21, 0x14, 0x14, 0x1C, 0x1C, 0x1B, 0x1B, 0x13, 0x13, 0x1B, 0x1B, 0x1C, 0x1C, 0x1A, 0x1A,
+	0x21, 0x21, 0x14, 0x14, 0x1C, 0x1C, 0x1B, 0x1B, 0x13, 0x13, 0x1B, 0x1B, 0x1C, 0x1C, 0x1A, 0x1A, 0x21, 0x21, 0x14, 0x14, 0x1C, 0x1C, 0x1B, 0x1B,
+	0x13, 0x13, 0x1B, 0x1B, 0x1C, 0x1C, 0x1A, 0x1A, 0x21, 0x21, 0x14, 0x14, 0x1C, 0x1C, 0x1B, 0x1B, 0x13, 0x13, 0x1B, 0x1B, 0x1C, 0x1C, 0x1A, 0x1A,
+	0x16, 0x16, 0x1A, 0x1A, 0x1B, 0x1B, 0x1B, 0x1B, 0x22, 0x22, 0x1B, 0x1B, 0x27, 0x27, 0x1A, 0x1A, 0x16, 0x16, 0x1A, 0x1A, 0x1B, 0x1B, 0x1B, 0x1B,
+	0x22, 0x22, 0x1B, 0x1B, 0x27, 0x27, 0x1A, 0x1A, 0x34, 0x34, 0x1A, 0x1A, 0x1C, 0x1C, 0x1B, 0x1B, 0x13, 0x13, 0x1B, 0x1B, 0x1C, 0x1C, 0x2D, 0x2D,
+	0x34, 0x34, 0x1A, 0x1A, 0x1C, 0x1C, 0x1B, 0x1B, 0x13, 0x13, 0x1B, 0x1B, 0x1C, 0x1C, 0x2D, 0x2D, 0x39, 0x39, 0x3C, 0x3C, 0x2C, 0x2C, 0x27, 0x27,
+	0x2A, 0x2A, 0x2B, 0x2B, 0x2C, 0x2C, 0x47, 0x47, 0x39, 0x39, 0x3C, 0x3C, 0x2C, 0x2C, 0x27, 0x27, 0x2A, 0x2A, 0x2B, 0x2B, 0x2C, 0x2C, 0x47, 0x47,
+	0x44, 0x44, 0x42, 0x42, 0x37, 0x37, 0x32, 0x32, 0x53, 0x53, 0x36, 0x36, 0x38, 0x38, 0x42, 0x42, 0x44, 0x44, 0x42, 0x42, 0x37, 0x37, 0x32, 0x32,
+	0x53, 0x53, 0x36, 0x36, 0x38, 0x38, 0x42, 0x42, 0x42, 0x42, 0x37, 0x37, 0x37, 0x37, 0x54, 0x54, 0x37, 0x37, 0x44, 0x44, 0x4C, 0x4C, 0x48, 0x48,
+	0x42, 0x42, 0x37, 0x37, 0x37, 0x37, 0x54, 0x54, 0x37, 0x37, 0x44, 0x44, 0x4C, 0x4C, 0x48, 0x48, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x4D, 0x4D,
+	0x4B, 0x4B, 0x4C, 0x4C, 0x4E, 0x4E, 0x55, 0x55, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x4D, 0x4D, 0x4B, 0x4B, 0x4C, 0x4C, 0x4E, 0x4E, 0x55, 0x55,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x4C, 0x4C, 0x4C, 0x4C, 0x50, 0x50, 0x50, 0x50, 0x4E, 0x4E, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x4C, 0x4C,
+	0x4C, 0x4C, 0x50, 0x50, 0x50, 0x50, 0x4E, 0x4E, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x50, 0x50,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x50, 0x50, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55,
+	0x4E, 0x4E, 0x50, 0x50, 0x50, 0x50, 0x4E, 0x4E, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x4E, 0x4E, 0x50, 0x50, 0x50, 0x50, 0x4E, 0x4E,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x56, 0x56, 0x4E, 0x4E, 0x55, 0x55, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55,
+	0x56, 0x56, 0x4E, 0x4E, 0x55, 0x55, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x48, 0x48,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x48, 0x48, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x4C, 0x4C, 0x4C, 0x4C, 0x4B, 0x4B, 0x48, 0x48, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x4C, 0x4C, 0x4C, 0x4C, 0x4B, 0x4B, 0x55, 0x55, 0x55, 0x55, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x50, 0x50,
+	0x55, 0x55, 0x55, 0x55, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x50, 0x50, 0x4E, 0x4E, 0x56, 0x56, 0x50, 0x50, 0x50, 0x50,
+	0x50, 0x50, 0x4E, 0x4E, 0x50, 0x50, 0x4E, 0x4E, 0x4E, 0x4E, 0x56, 0x56, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x4E, 0x4E, 0x50, 0x50, 0x4E, 0x4E,
+	0x56, 0x56, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x50, 0x50, 0x50, 0x50, 0x4E, 0x4E, 0x56, 0x56, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E,
+	0x4E, 0x4E, 0x50, 0x50, 0x50, 0x50, 0x4E, 0x4E, 0x4E, 0x4E, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x4E, 0x4E, 0x4E, 0x4E, 0x56, 0x56,
+	0x4E, 0x4E, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x4E, 0x4E, 0x4E, 0x4E, 0x56, 0x56, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x48, 0x48, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x4B, 0x4B, 0x4F, 0x4F, 0x4D, 0x4D, 0x44, 0x44,
+	0x43, 0x43, 0x4C, 0x4C, 0x4C, 0x4C, 0x50, 0x50, 0x4B, 0x4B, 0x4F, 0x4F, 0x4D, 0x4D, 0x44, 0x44, 0x43, 0x43, 0x4C, 0x4C, 0x4C, 0x4C, 0x50, 0x50,
+	0x50, 0x50, 0x4C, 0x4C, 0x43, 0x43, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0x50, 0x4C, 0x4C, 0x43, 0x43, 0x48, 0x48,
+	0x48, 0x48, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x4E, 0x4E, 0x4E, 0x4E, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55,
+	0x4E, 0x4E, 0x4E, 0x4E, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x4E, 0x4E, 0x55, 0x55, 0x55, 0x55, 0x48, 0x48,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x4E, 0x4E, 0x55, 0x55, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x56, 0x56, 0x55, 0x55, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x56, 0x56, 0x55, 0x55, 0x55, 0x55, 0x48, 0x48,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x4E, 0x4E, 0x56, 0x56, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x4E, 0x4E, 0x56, 0x56, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x48, 0x48,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x50, 0x50, 0x4E, 0x4E, 0x55, 0x55, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x4C, 0x4C, 0x4C, 0x4C,
+	0x50, 0x50, 0x4E, 0x4E, 0x55, 0x55, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x4C, 0x4C, 0x4C, 0x4C, 0x4E, 0x4E, 0x56, 0x56, 0x56, 0x56, 0x4E, 0x4E,
+	0x55, 0x55, 0x55, 0x55, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x56, 0x56, 0x56, 0x56, 0x4E, 0x4E, 0x55, 0x55, 0x55, 0x55, 0x4E, 0x4E, 0x4E, 0x4E,
+	0x55, 0x55, 0x4E, 0x4E, 0x4E, 0x4E, 0x50, 0x50, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x50, 0x50, 0x55, 0x55, 0x4E, 0x4E, 0x4E, 0x4E, 0x50, 0x50,
+	0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x50, 0x50, 0x48, 0x48, 0x55, 0x55, 0x4E, 0x4E, 0x50, 0x50, 0x4E, 0x4E, 0x50, 0x50, 0x56, 0x56, 0x4E, 0x4E,
+	0x48, 0x48, 0x55, 0x55, 0x4E, 0x4E, 0x50, 0x50, 0x4E, 0x4E, 0x50, 0x50, 0x56, 0x56, 0x4E, 0x4E, 0x48, 0x48, 0x55, 0x55, 0x4E, 0x4E, 0x50, 0x50,
+	0x50, 0x50, 0x4E, 0x4E, 0x55, 0x55, 0x55, 0x55, 0x48, 0x48, 0x55, 0x55, 0x4E, 0x4E, 0x50, 0x50, 0x50, 0x50, 0x4E, 0x4E, 0x55, 0x55, 0x55, 0x55,
+	0x48, 0x48, 0x55, 0x55, 0x56, 0x56, 0x4E, 0x4E, 0x4E, 0x4E, 0x55, 0x55, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x56, 0x56, 0x4E, 0x4E,
+	0x4E, 0x4E, 0x55, 0x55, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x48, 0x48, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x50, 0x50, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E,
+	0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x4E, 0x4E, 0x50, 0x50, 0x50, 0x50, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E,
+	0x50, 0x50, 0x4E, 0x4E, 0x50, 0x50, 0x50, 0x50, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x4E, 0x4E,
+	0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x50, 0x50,
+	0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x50, 0x50, 0x50, 0x50, 0x4E, 0x4E, 0x4E, 0x4E, 0x50, 0x50, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x50, 0x50,
+	0x50, 0x50, 0x4E, 0x4E, 0x4E, 0x4E, 0x50, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x4E, 0x4E, 0x50, 0x50, 0x50, 0x50, 0x4E, 0x4E,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x4E, 0x4E, 0x50, 0x50, 0x50, 0x50, 0x4E, 0x4E, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55,
+	0x55, 0x55, 0x4E, 0x4E, 0x56, 0x56, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x55, 0x55, 0x4E, 0x4E, 0x56, 0x56, 0x55, 0x55,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x48, 0x48, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x4C, 0x4C, 0x44, 0x44, 0x42, 0x42, 0x38, 0x38,
+	0x3E, 0x3E, 0x3F, 0x3F, 0x43, 0x43, 0x4C, 0x4C, 0x4C, 0x4C, 0x44, 0x44, 0x42, 0x42, 0x38, 0x38, 0x3E, 0x3E, 0x3F, 0x3F, 0x43, 0x43, 0x4C, 0x4C,
+	0x50, 0x50, 0x50, 0x50, 0x4C, 0x4C, 0x4C, 0x4C, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x55, 0x55, 0x50, 0x50, 0x50, 0x50, 0x4C, 0x4C, 0x4C, 0x4C,
+	0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x55, 0x55, 0x4E, 0x4E, 0x4E, 0x4E, 0x55, 0x55, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x4E, 0x4E, 0x4E, 0x4E, 0x55, 0x55, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x4E, 0x4E, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x4E, 0x4E, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x50, 0x50, 0x50, 0x50, 0x4E, 0x4E, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x4E, 0x4E,
+	0x50, 0x50, 0x50, 0x50, 0x4E, 0x4E, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x4E, 0x4E, 0x55, 0x55, 0x4E, 0x4E, 0x56, 0x56, 0x56, 0x56,
+	0x4E, 0x4E, 0x55, 0x55, 0x55, 0x55, 0x4E, 0x4E, 0x55, 0x55, 0x4E, 0x4E, 0x56, 0x56, 0x56, 0x56, 0x4E, 0x4E, 0x55, 0x55, 0x55, 0x55, 0x4E, 0x4E,
+	0x55, 0x55, 0x55, 0x55, 0x4E, 0x4E, 0x4E, 0x4E, 0x56, 0x56, 0x4E, 0x4E, 0x55, 0x55, 0x4E, 0x4E, 0x55, 0x55, 0x55, 0x55, 0x4E, 0x4E, 0x4E, 0x4E,
+	0x56, 0x56, 0x4E, 0x4E, 0x55, 0x55, 0x4E, 0x4E, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x4E, 0x4E, 0x50, 0x50, 0x4E, 0x4E, 0x4E, 0x4E, 0x56, 0x56,
+	0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x4E, 0x4E, 0x50, 0x50, 0x4E, 0x4E, 0x4E, 0x4E, 0x56, 0x56, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55,
+	0x4E, 0x4E, 0x50, 0x50, 0x50, 0x50, 0x4E, 0x4E, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x4E, 0x4E, 0x50, 0x50, 0x50, 0x50, 0x4E, 0x4E,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x55, 0x55, 0x56, 0x56, 0x4E, 0x4E, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55,
+	0x55, 0x55, 0x56, 0x56, 0x4E, 0x4E, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x48, 0x48,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x4E, 0x4E, 0x50, 0x50, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x50, 0x50, 0x50, 0x50, 0x4E, 0x4E, 0x50, 0x50, 0x4E, 0x4E, 0x4E, 0x4E,
+	0x4E, 0x4E, 0x4E, 0x4E, 0x50, 0x50, 0x50, 0x50, 0x4E, 0x4E, 0x50, 0x50, 0x4E, 0x4E, 0x4E, 0x4E, 0x50, 0x50, 0x50, 0x50, 0x4E, 0x4E, 0x4E, 0x4E,
+	0x4E, 0x4E, 0x50, 0x50, 0x4E, 0x4E, 0x4E, 0x4E, 0x50, 0x50, 0x50, 0x50, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+	0x50, 0x50, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E,
+	0x56, 0x56, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x50, 0x50, 0x50, 0x50, 0x4E, 0x4E, 0x56, 0x56, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E,
+	0x4E, 0x4E, 0x50, 0x50, 0x50, 0x50, 0x4E, 0x4E, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x4E, 0x4E, 0x56, 0x56,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x4E, 0x4E, 0x56, 0x56, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x48, 0x48, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x4B, 0x4B, 0x4F, 0x4F, 0x4D, 0x4D, 0x44, 0x44,
+	0x44, 0x44, 0x42, 0x42, 0x37, 0x37, 0x37, 0x37, 0x4B, 0x4B, 0x4F, 0x4F, 0x4D, 0x4D, 0x44, 0x44, 0x44, 0x44, 0x42, 0x42, 0x37, 0x37, 0x37, 0x37,
+	0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x48, 0x48, 0x48, 0x48, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x48, 0x48,
+	0x48, 0x48, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x56, 0x56, 0x55, 0x55, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x56, 0x56, 0x55, 0x55, 0x55, 0x55, 0x48, 0x48,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x4E, 0x4E, 0x56, 0x56, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x4E, 0x4E, 0x56, 0x56, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x48, 0x48,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x54, 0x54, 0x37, 0x37, 0x44, 0x44, 0x4C, 0x4C, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x55, 0x55,
+	0x54, 0x54, 0x37, 0x37, 0x44, 0x44, 0x4C, 0x4C, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x55, 0x55, 0x4D, 0x4D, 0x4B, 0x4B, 0x4C, 0x4C, 0x4E, 0x4E,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x4E, 0x4E, 0x4D, 0x4D, 0x4B, 0x4B, 0x4C, 0x4C, 0x4E, 0x4E, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x4E, 0x4E,
+	0x4C, 0x4C, 0x4C, 0x4C, 0x50, 0x50, 0x50, 0x50, 0x4E, 0x4E, 0x4E, 0x4E, 0x56, 0x56, 0x50, 0x50, 0x4C, 0x4C, 0x4C, 0x4C, 0x50, 0x50, 0x50, 0x50,
+	0x4E, 0x4E, 0x4E, 0x4E, 0x56, 0x56, 0x50, 0x50, 0x55, 0x55, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x50, 0x50, 0x56, 0x56, 0x4E, 0x4E, 0x4E, 0x4E,
+	0x55, 0x55, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x50, 0x50, 0x56, 0x56, 0x4E, 0x4E, 0x4E, 0x4E, 0x55, 0x55, 0x4E, 0x4E, 0x50, 0x50, 0x50, 0x50,
+	0x4E, 0x4E, 0x4E, 0x4E, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x4E, 0x4E, 0x50, 0x50, 0x50, 0x50, 0x4E, 0x4E, 0x4E, 0x4E, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x56, 0x56, 0x4E, 0x4E, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x56, 0x56, 0x4E, 0x4E, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x55, 0x55, 0x55, 0x55, 0x4C, 0x4C, 0x4C, 0x4C, 0x4B, 0x4B, 0x4B, 0x4B, 0x4F, 0x4F, 0x4D, 0x4D, 0x55, 0x55, 0x55, 0x55, 0x4C, 0x4C, 0x4C, 0x4C,
+	0x4B, 0x4B, 0x4B, 0x4B, 0x4F, 0x4F, 0x4D, 0x4D, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x50, 0x50, 0x50, 0x50, 0x4C, 0x4C, 0x43, 0x43,
+	0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x50, 0x50, 0x50, 0x50, 0x4C, 0x4C, 0x43, 0x43, 0x50, 0x50, 0x50, 0x50, 0x4E, 0x4E, 0x50, 0x50,
+	0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x55, 0x55, 0x50, 0x50, 0x50, 0x50, 0x4E, 0x4E, 0x50, 0x50, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x55, 0x55,
+	0x4E, 0x4E, 0x4E, 0x4E, 0x50, 0x50, 0x50, 0x50, 0x4E, 0x4E, 0x4E, 0x4E, 0x55, 0x55, 0x55, 0x55, 0x4E, 0x4E, 0x4E, 0x4E, 0x50, 0x50, 0x50, 0x50,
+	0x4E, 0x4E, 0x4E, 0x4E, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x4E, 0x4E, 0x4E, 0x4E, 0x56, 0x56, 0x56, 0x56, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x4E, 0x4E, 0x4E, 0x4E, 0x56, 0x56, 0x56, 0x56, 0x55, 0x55, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x4E, 0x4E, 0x56, 0x56, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x4E, 0x4E, 0x56, 0x56, 0x55, 0x55,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x44, 0x44, 0x43, 0x43, 0x4C, 0x4C, 0x4C, 0x4C,
+	0x50, 0x50, 0x50, 0x50, 0x4E, 0x4E, 0x55, 0x55, 0x44, 0x44, 0x43, 0x43, 0x4C, 0x4C, 0x4C, 0x4C, 0x50, 0x50, 0x50, 0x50, 0x4E, 0x4E, 0x55, 0x55,
+	0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x4E, 0x4E, 0x56, 0x56, 0x56, 0x56, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x4E, 0x4E, 0x56, 0x56, 0x56, 0x56, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x55, 0x55, 0x4E, 0x4E, 0x4E, 0x4E,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x55, 0x55, 0x4E, 0x4E, 0x4E, 0x4E, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x4E, 0x4E, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x4E, 0x4E,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x4E, 0x4E, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x4E, 0x4E, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x56, 0x56,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x56, 0x56, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x55, 0x55,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x4C, 0x4C, 0x4C, 0x4C, 0x50, 0x50, 0x4E, 0x4E, 0x4E, 0x4E,
+	0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x4C, 0x4C, 0x4C, 0x4C, 0x50, 0x50, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x55, 0x55, 0x55, 0x55, 0x4E, 0x4E,
+	0x4E, 0x4E, 0x50, 0x50, 0x4E, 0x4E, 0x50, 0x50, 0x4E, 0x4E, 0x55, 0x55, 0x55, 0x55, 0x4E, 0x4E, 0x4E, 0x4E, 0x50, 0x50, 0x4E, 0x4E, 0x50, 0x50,
+	0x50, 0x50, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E,
+	0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x4E, 0x4E, 0x50, 0x50, 0x56, 0x56, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E,
+	0x50, 0x50, 0x4E, 0x4E, 0x50, 0x50, 0x56, 0x56, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x50, 0x50, 0x50, 0x50, 0x4E, 0x4E, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0x50, 0x50, 0x50, 0x4E, 0x4E, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x4E, 0x4E, 0x4E, 0x4E, 0x55, 0x55, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x4E, 0x4E, 0x4E, 0x4E, 0x55, 0x55, 0x55, 0x55,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x55, 0x55, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x4E, 0x4E, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x4C, 0x4C, 0x44, 0x44, 0x42, 0x42, 0x4E, 0x4E, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+	0x50, 0x50, 0x4C, 0x4C, 0x44, 0x44, 0x42, 0x42, 0x50, 0x50, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x50, 0x50, 0x50, 0x50, 0x4C, 0x4C,
+	0x50, 0x50, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x50, 0x50, 0x50, 0x50, 0x4C, 0x4C, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E,
+	0x50, 0x50, 0x4E, 0x4E, 0x4E, 0x4E, 0x55, 0x55, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x50, 0x50, 0x4E, 0x4E, 0x4E, 0x4E, 0x55, 0x55,
+	0x50, 0x50, 0x50, 0x50, 0x4E, 0x4E, 0x4E, 0x4E, 0x50, 0x50, 0x4E, 0x4E, 0x55, 0x55, 0x48, 0x48, 0x50, 0x50, 0x50, 0x50, 0x4E, 0x4E, 0x4E, 0x4E,
+	0x50, 0x50, 0x4E, 0x4E, 0x55, 0x55, 0x48, 0x48, 0x55, 0x55, 0x4E, 0x4E, 0x50, 0x50, 0x50, 0x50, 0x4E, 0x4E, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48,
+	0x55, 0x55, 0x4E, 0x4E, 0x50, 0x50, 0x50, 0x50, 0x4E, 0x4E, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x55, 0x55, 0x4E, 0x4E, 0x56, 0x56,
+	0x55, 0x55, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x55, 0x55, 0x4E, 0x4E, 0x56, 0x56, 0x55, 0x55, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48,
+	0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x38, 0x38, 0x3E, 0x3E, 0x3F, 0x3F, 0x43, 0x43,
+	0x4C, 0x4C, 0x50, 0x50, 0x50, 0x50, 0x4E, 0x4E, 0x38, 0x38, 0x3E, 0x3E, 0x3F, 0x3F, 0x43, 0x43, 0x4C, 0x4C, 0x50, 0x50, 0x50, 0x50, 0x4E, 0x4E,
+	0x4C, 0x4C, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x4E, 0x4E, 0x56, 0x56, 0x4C, 0x4C, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x4E, 0x4E, 0x56, 0x56, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x55, 0x55, 0x4E, 0x4E,
+	0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x55, 0x55, 0x4E, 0x4E, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x4E, 0x4E, 0x4E, 0x4E, 0x50, 0x50, 0x4E, 0x4E,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x4E, 0x4E, 0x4E, 0x4E, 0x50, 0x50, 0x4E, 0x4E, 0x56, 0x56, 0x4E, 0x4E, 0x55, 0x55, 0x55, 0x55,
+	0x4E, 0x4E, 0x4E, 0x4E, 0x50, 0x50, 0x4E, 0x4E, 0x56, 0x56, 0x4E, 0x4E, 0x55, 0x55, 0x55, 0x55, 0x4E, 0x4E, 0x4E, 0x4E, 0x50, 0x50, 0x4E, 0x4E,
+	0x4E, 0x4E, 0x56, 0x56, 0x4E, 0x4E, 0x55, 0x55, 0x4E, 0x4E, 0x4E, 0x4E, 0x50, 0x50, 0x50, 0x50, 0x4E, 0x4E, 0x56, 0x56, 0x4E, 0x4E, 0x55, 0x55,
+	0x4E, 0x4E, 0x4E, 0x4E, 0x50, 0x50, 0x50, 0x50, 0x4E, 0x4E, 0x50, 0x50, 0x4E, 0x4E, 0x4E, 0x4E, 0x56, 0x56, 0x56, 0x56, 0x4E, 0x4E, 0x4E, 0x4E,
+	0x4E, 0x4E, 0x50, 0x50, 0x4E, 0x4E, 0x4E, 0x4E, 0x56, 0x56, 0x56, 0x56, 0x4E, 0x4E, 0x4E, 0x4E, 0x55, 0x55, 0x4E, 0x4E, 0x50, 0x50, 0x50, 0x50,
+	0x4E, 0x4E, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x4E, 0x4E, 0x50, 0x50, 0x50, 0x50, 0x4E, 0x4E, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x56, 0x56, 0x4E, 0x4E, 0x55, 0x55, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x55, 0x55, 0x56, 0x56, 0x4E, 0x4E,
+	0x55, 0x55, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x48, 0x48, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x50, 0x50, 0x50, 0x50, 0x4B, 0x4B, 0x4F, 0x4F, 0x4D, 0x4D, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x50, 0x50,
+	0x50, 0x50, 0x4B, 0x4B, 0x4F, 0x4F, 0x4D, 0x4D, 0x4E, 0x4E, 0x50, 0x50, 0x50, 0x50, 0x4E, 0x4E, 0x4E, 0x4E, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C,
+	0x4E, 0x4E, 0x50, 0x50, 0x50, 0x50, 0x4E, 0x4E, 0x4E, 0x4E, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x50, 0x50, 0x50, 0x50, 0x4E, 0x4E, 0x4E, 0x4E,
+	0x4E, 0x4E, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0x50, 0x50, 0x50, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x4E, 0x4E, 0x4E, 0x4E, 0x50, 0x50, 0x50, 0x50, 0x4E, 0x4E, 0x55, 0x55, 0x55, 0x55, 0x48, 0x48, 0x4E, 0x4E, 0x4E, 0x4E, 0x50, 0x50, 0x50, 0x50,
+	0x4E, 0x4E, 0x55, 0x55, 0x55, 0x55, 0x48, 0x48, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x4E, 0x4E, 0x56, 0x56, 0x56, 0x56, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x4E, 0x4E, 0x56, 0x56, 0x56, 0x56, 0x55, 0x55, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x4E, 0x4E, 0x56, 0x56, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x4E, 0x4E, 0x56, 0x56, 0x55, 0x55,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x44, 0x44, 0x44, 0x44, 0x38, 0x38, 0x37, 0x37,
+	0x36, 0x36, 0x54, 0x54, 0x37, 0x37, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x38, 0x38, 0x37, 0x37, 0x36, 0x36, 0x54, 0x54, 0x37, 0x37, 0x44, 0x44,
+	0x48, 0x48, 0x48, 0x48, 0x3F, 0x3F, 0x3F, 0x3F, 0x43, 0x43, 0x4D, 0x4D, 0x4B, 0x4B, 0x4C, 0x4C, 0x48, 0x48, 0x48, 0x48, 0x3F, 0x3F, 0x3F, 0x3F,
+	0x43, 0x43, 0x4D, 0x4D, 0x4B, 0x4B, 0x4C, 0x4C, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x4C, 0x4C, 0x4C, 0x4C, 0x50, 0x50,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x4C, 0x4C, 0x4C, 0x4C, 0x50, 0x50, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x48, 0x48, 0x55, 0x55, 0x4E, 0x4E, 0x4E, 0x4E, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x4E, 0x4E, 0x4E, 0x4E,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x4E, 0x4E, 0x50, 0x50, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x48, 0x48, 0x55, 0x55, 0x4E, 0x4E, 0x50, 0x50, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x56, 0x56, 0x4E, 0x4E,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x56, 0x56, 0x4E, 0x4E, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x48, 0x48, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x43, 0x43, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x48, 0x48,
+	0x43, 0x43, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x48, 0x48, 0x4E, 0x4E, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E,
+	0x50, 0x50, 0x4E, 0x4E, 0x4E, 0x4E, 0x56, 0x56, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x4E, 0x4E, 0x50, 0x50, 0x4E, 0x4E, 0x4E, 0x4E, 0x56, 0x56,
+	0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x4E, 0x4E, 0x4E, 0x4E, 0x50, 0x50, 0x56, 0x56, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x50, 0x50,
+	0x4E, 0x4E, 0x50, 0x50, 0x56, 0x56, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x4E, 0x50, 0x50, 0x50, 0x50, 0x4E, 0x4E, 0x4E, 0x4E, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x4E, 0x4E, 0x50, 0x50, 0x4E, 0x4E, 0x4E, 0x4E, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x4E, 0x4E,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x48, 0x48,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x4C, 0x4C, 0x4C, 0x4C, 0x43, 0x43, 0x4D, 0x4D, 0x4D, 0x4D, 0x3F, 0x3F, 0x43, 0x43, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x4C, 0x43, 0x43, 0x4D, 0x4D,
+	0x4D, 0x4D, 0x3F, 0x3F, 0x43, 0x43, 0x4C, 0x4C, 0x4E, 0x4E, 0x50, 0x50, 0x50, 0x50, 0x4C, 0x4C, 0x3F, 0x3F, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55,
+	0x4E, 0x4E, 0x50, 0x50, 0x50, 0x50, 0x4C, 0x4C, 0x3F, 0x3F, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x50, 0x50, 0x4E, 0x4E, 0x4E, 0x4E, 0x55, 0x55,
+	0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x50, 0x50, 0x4E, 0x4E, 0x4E, 0x4E, 0x55, 0x55, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x50, 0x50, 0x4E, 0x4E, 0x4E, 0x4E, 0x55, 0x55, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x50, 0x50, 0x4E, 0x4E, 0x4E, 0x4E, 0x55, 0x55,
+	0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x4E, 0x4E, 0x56, 0x56, 0x56, 0x56, 0x55, 0x55, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x4E, 0x4E, 0x56, 0x56, 0x56, 0x56, 0x55, 0x55, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x55, 0x55, 0x4E, 0x4E, 0x56, 0x56,
+	0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x55, 0x55, 0x4E, 0x4E, 0x56, 0x56, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x48, 0x48, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
+	0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+const uint8_t embedded_background_tile_map[] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 4, 0, 0, 0, 0, 0, 0,
+	0, 5, 6, 0, 0, 0, 0, 0, 0, 0, 7, 0, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19,
+	20, 21, 22, 23, 24, 25, 26, 27, 1, 28, 29, 30, 31, 1, 32, 33, 34, 1, 35, 36, 37, 38, 39, 40,
+	41, 42, 1, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 50,
+	63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86,
+	87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	103, 103, 103, 103, 103, 103, 103, 103,
+};
+const uint32_t embedded_background_row_spans[] = {
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23,
+	24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+	48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71,
+	72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+	96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119,
+	120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+	144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167,
+	168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+	192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215,
+	216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239,
+	240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 260, 261, 262, 263,
+	264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287,
+	288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311,
+	312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 335,
+	336, 337, 338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359,
+	360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373, 374, 375, 376, 377, 378, 379, 380, 381, 382, 383,
+	384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, 402, 403, 404, 405, 406, 407,
+	408, 409, 410, 411, 412, 413, 414, 415, 416, 417, 418, 419, 420, 421, 422, 423, 424, 425, 426, 427, 428, 429, 430, 431,
+	432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449, 450, 451, 452, 453, 454, 455,
+	456, 457, 458, 459, 460, 461, 462, 463, 464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474, 475, 476, 477, 478, 479,
+	480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496, 497, 498, 499, 500, 501, 502, 503,
+	504, 505, 506, 507, 508, 509, 510, 511, 512, 513, 514, 515, 516, 517, 518, 519, 520, 521, 522, 523, 524, 525, 526, 527,
+	528, 529, 530, 531, 532, 533, 534, 535, 536, 537, 538,
+};
+const TextureSpan embedded_background_spans[] = {
+	{0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320},
+	{0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320},
+	{0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320},
+	{0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320},
+	{0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320},
+	{0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320},
+	{0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320},
+	{0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320},
+	{0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320},
+	{0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320},
+	{0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320},
+	{0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320},
+	{0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320},
+	{0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320},
+	{0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320},
+	{0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320},
+	{0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320},
+	{0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320},
+	{0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320},
+	{0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320},
+	{0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320},
+	{0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320},
+	{0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320},
+	{0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320},
+	{0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320},
+	{0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320},
+	{0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320},
+	{0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320},
+	{0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320},
+	{0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320},
+	{0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320},
+	{0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320},
+	{0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320},
+	{0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320},
+	{0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320},
+	{0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320},
+	{0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320},
+	{0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320},
+	{0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320},
+	{0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320},
+	{0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320},
+	{0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320},
+	{0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320},
+	{0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320},
+	{0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320}, {0, 320},
+};
+Texture embedded_background = {320, 538, TEXTURE_TILED8, 16, embedded_background_palette, embedded_background_texels, 0, embedded_background_tile_map, 4, 3, embedded_background_row_spans, embedded_background_spans, 0};
+
+// flappy0: 34x24 TEXTURE_INDEXED4, 432 byte file
+const uint16_t embedded_flappy0_palette[] = {
+	0xF81F, 0x51C8, 0xFEB1, 0xFFDF, 0xFDA6, 0xD739, 0xF9C0, 0xE405,
+};
+const uint8_t embedded_flappy0_texels[] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
+	0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x22, 0x22, 0x22, 0x11, 0x33, 0x33, 0x11, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x22, 0x22, 0x22, 0x11, 0x33, 0x33, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
+	0x22, 0x22, 0x44, 0x44, 0x11, 0x33, 0x33, 0x33, 0x33, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x22, 0x22, 0x44, 0x44, 0x11, 0x33, 0x33,
+	0x33, 0x33, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x22, 0x44, 0x44, 0x44, 0x44, 0x11, 0x55, 0x33, 0x33, 0x11, 0x33, 0x11, 0x00, 0x00, 0x00,
+	0x00, 0x11, 0x22, 0x44, 0x44, 0x44, 0x44, 0x11, 0x55, 0x33, 0x33, 0x11, 0x33, 0x11, 0x00, 0x00, 0x00, 0x11, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+	0x11, 0x55, 0x33, 0x33, 0x11, 0x33, 0x11, 0x00, 0x00, 0x00, 0x11, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x11, 0x55, 0x33, 0x33, 0x11, 0x33, 0x11,
+	0x00, 0x00, 0x00, 0x11, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x11, 0x55, 0x33, 0x33, 0x33, 0x11, 0x00, 0x00, 0x00, 0x11, 0x44, 0x44, 0x44,
+	0x44, 0x44, 0x44, 0x44, 0x11, 0x55, 0x33, 0x33, 0x33, 0x11, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x44, 0x44, 0x44, 0x44, 0x11, 0x11,
+	0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x44, 0x44, 0x44, 0x44, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x22,
+	0x33, 0x33, 0x33, 0x22, 0x11, 0x44, 0x44, 0x11, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x11, 0x11, 0x22, 0x33, 0x33, 0x33, 0x22, 0x11, 0x44, 0x44,
+	0x11, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x11, 0x11, 0x33, 0x33, 0x33, 0x33, 0x11, 0x77, 0x77, 0x11, 0x66, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+	0x00, 0x11, 0x33, 0x33, 0x33, 0x33, 0x11, 0x77, 0x77, 0x11, 0x66, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x33, 0x33, 0x22, 0x11, 0x77,
+	0x77, 0x77, 0x77, 0x11, 0x66, 0x66, 0x66, 0x66, 0x66, 0x11, 0x00, 0x11, 0x33, 0x33, 0x22, 0x11, 0x77, 0x77, 0x77, 0x77, 0x11, 0x66, 0x66, 0x66,
+	0x66, 0x66, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x77, 0x77, 0x77, 0x77, 0x77, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x11, 0x11,
+	0x11, 0x11, 0x77, 0x77, 0x77, 0x77, 0x77, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+const uint32_t embedded_flappy0_row_spans[] = {
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23,
+	24,
+};
+const TextureSpan embedded_flappy0_spans[] = {
+	{12, 12}, {12, 12}, {8, 18}, {8, 18}, {6, 22}, {6, 22}, {4, 26}, {4, 26}, {2, 28}, {2, 28}, {2, 28}, {2, 28},
+	{2, 30}, {2, 30}, {0, 34}, {0, 34}, {0, 32}, {0, 32}, {0, 32}, {0, 32}, {2, 28}, {2, 28}, {10, 10}, {10, 10},
+};
+Texture embedded_flappy0 = {34, 24, TEXTURE_INDEXED4, 17, embedded_flappy0_palette, embedded_flappy0_texels, 0, 0, 0, 0, embedded_flappy0_row_spans, embedded_flappy0_spans, 0};
+
+// flappy1: 34x24 TEXTURE_INDEXED4, 432 byte file
+const uint16_t embedded_flappy1_palette[] = {
+	0xF81F, 0x51C8, 0xFEB1, 0xFFDF, 0xFDA6, 0xD739, 0xF9C0, 0xE405,
+};
+const uint8_t embedded_flappy1_texels[] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
+	0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x22, 0x22, 0x22, 0x11, 0x33, 0x33, 0x11, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x22, 0x22, 0x22, 0x11, 0x33, 0x33, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
+	0x22, 0x22, 0x44, 0x44, 0x11, 0x33, 0x33, 0x33, 0x33, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x22, 0x22, 0x44, 0x44, 0x11, 0x33, 0x33,
+	0x33, 0x33, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x22, 0x44, 0x44, 0x44, 0x44, 0x11, 0x55, 0x33, 0x33, 0x11, 0x33, 0x11, 0x00, 0x00, 0x00,
+	0x00, 0x11, 0x22, 0x44, 0x44, 0x44, 0x44, 0x11, 0x55, 0x33, 0x33, 0x11, 0x33, 0x11, 0x00, 0x00, 0x00, 0x11, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+	0x11, 0x55, 0x33, 0x33, 0x11, 0x33, 0x11, 0x00, 0x00, 0x00, 0x11, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x11, 0x55, 0x33, 0x33, 0x11, 0x33, 0x11,
+	0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x44, 0x44, 0x44, 0x11, 0x55, 0x33, 0x33, 0x33, 0x11, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
+	0x11, 0x44, 0x44, 0x44, 0x11, 0x55, 0x33, 0x33, 0x33, 0x11, 0x00, 0x00, 0x11, 0x33, 0x33, 0x33, 0x33, 0x33, 0x11, 0x44, 0x44, 0x44, 0x11, 0x11,
+	0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x33, 0x33, 0x33, 0x33, 0x33, 0x11, 0x44, 0x44, 0x44, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x22,
+	0x33, 0x33, 0x33, 0x22, 0x11, 0x44, 0x44, 0x11, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x11, 0x11, 0x22, 0x33, 0x33, 0x33, 0x22, 0x11, 0x44, 0x44,
+	0x11, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x77, 0x77, 0x11, 0x66, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+	0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x77, 0x77, 0x11, 0x66, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x11, 0x77, 0x77, 0x77,
+	0x77, 0x77, 0x77, 0x11, 0x66, 0x66, 0x66, 0x66, 0x66, 0x11, 0x00, 0x00, 0x00, 0x11, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x11, 0x66, 0x66, 0x66,
+	0x66, 0x66, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x77, 0x77, 0x77, 0x77, 0x77, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x11, 0x11, 0x77, 0x77, 0x77, 0x77, 0x77, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+const uint32_t embedded_flappy1_row_spans[] = {
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23,
+	24,
+};
+const TextureSpan embedded_flappy1_spans[] = {
+	{12, 12}, {12, 12}, {8, 18}, {8, 18}, {6, 22}, {6, 22}, {4, 26}, {4, 26}, {2, 28}, {2, 28}, {2, 28}, {2, 28},
+	{0, 32}, {0, 32}, {0, 34}, {0, 34}, {2, 30}, {2, 30}, {4, 28}, {4, 28}, {6, 24}, {6, 24}, {10, 10}, {10, 10},
+};
+Texture embedded_flappy1 = {34, 24, TEXTURE_INDEXED4, 17, embedded_flappy1_palette, embedded_flappy1_texels, 0, 0, 0, 0, embedded_flappy1_row_spans, embedded_flappy1_spans, 0};
+
+// flappy2: 34x24 TEXTURE_INDEXED4, 432 byte file
+const uint16_t embedded_flappy2_palette[] = {
+	0xF81F, 0x51C8, 0xFEB1, 0xFFDF, 0xFDA6, 0xD739, 0xF9C0, 0xE405,
+};
+const uint8_t embedded_flappy2_texels[] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
+	0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x22, 0x22, 0x22, 0x11, 0x33, 0x33, 0x11, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x22, 0x22, 0x22, 0x11, 0x33, 0x33, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
+	0x22, 0x22, 0x44, 0x44, 0x11, 0x33, 0x33, 0x33, 0x33, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x22, 0x22, 0x44, 0x44, 0x11, 0x33, 0x33,
+	0x33, 0x33, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x44, 0x44, 0x44, 0x11, 0x55, 0x33, 0x33, 0x11, 0x33, 0x11, 0x00, 0x00, 0x00,
+	0x11, 0x11, 0x11, 0x11, 0x44, 0x44, 0x44, 0x11, 0x55, 0x33, 0x33, 0x11, 0x33, 0x11, 0x00, 0x00, 0x11, 0x33, 0x33, 0x33, 0x33, 0x11, 0x44, 0x44,
+	0x11, 0x55, 0x33, 0x33, 0x11, 0x33, 0x11, 0x00, 0x00, 0x11, 0x33, 0x33, 0x33, 0x33, 0x11, 0x44, 0x44, 0x11, 0x55, 0x33, 0x33, 0x11, 0x33, 0x11,
+	0x00, 0x00, 0x11, 0x33, 0x33, 0x33, 0x33, 0x33, 0x11, 0x44, 0x44, 0x11, 0x55, 0x33, 0x33, 0x33, 0x11, 0x00, 0x00, 0x11, 0x33, 0x33, 0x33, 0x33,
+	0x33, 0x11, 0x44, 0x44, 0x11, 0x55, 0x33, 0x33, 0x33, 0x11, 0x00, 0x00, 0x11, 0x22, 0x33, 0x33, 0x33, 0x22, 0x11, 0x44, 0x44, 0x44, 0x11, 0x11,
+	0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x22, 0x33, 0x33, 0x33, 0x22, 0x11, 0x44, 0x44, 0x44, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11,
+	0x22, 0x22, 0x22, 0x11, 0x44, 0x44, 0x44, 0x11, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x11, 0x00, 0x11, 0x22, 0x22, 0x22, 0x11, 0x44, 0x44, 0x44,
+	0x11, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x77, 0x77, 0x77, 0x11, 0x66, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+	0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x77, 0x77, 0x77, 0x11, 0x66, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x11, 0x77, 0x77, 0x77,
+	0x77, 0x77, 0x77, 0x11, 0x66, 0x66, 0x66, 0x66, 0x66, 0x11, 0x00, 0x00, 0x00, 0x11, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x11, 0x66, 0x66, 0x66,
+	0x66, 0x66, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x77, 0x77, 0x77, 0x77, 0x77, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x11, 0x11, 0x77, 0x77, 0x77, 0x77, 0x77, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+const uint32_t embedded_flappy2_row_spans[] = {
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23,
+	24,
+};
+const TextureSpan embedded_flappy2_spans[] = {
+	{12, 12}, {12, 12}, {8, 18}, {8, 18}, {6, 22}, {6, 22}, {2, 28}, {2, 28}, {0, 30}, {0, 30}, {0, 30}, {0, 30},
+	{0, 32}, {0, 32}, {2, 32}, {2, 32}, {4, 28}, {4, 28}, {4, 28}, {4, 28}, {6, 24}, {6, 24}, {10, 10}, {10, 10},
+};
+Texture embedded_flappy2 = {34, 24, TEXTURE_INDEXED4, 17, embedded_flappy2_palette, embedded_flappy2_texels, 0, 0, 0, 0, embedded_flappy2_row_spans, embedded_flappy2_spans, 0};
+
+// gameover: 192x100 TEXTURE_RLE8, 2505 byte file
+const uint16_t embedded_gameover_palette[] = {
+	0xF81F, 0x51C8, 0xFFFF, 0xFD09, 0xE303,
+};
+const uint8_t embedded_gameover_texels[] = {
+	0x83, 0x00, 0x91, 0x01, 0xD5, 0x00, 0x8B, 0x01, 0xBD, 0x00, 0x81, 0x00, 0x01, 0x01, 0x01, 0x8F, 0x02, 0x01, 0x01, 0x01, 0xD3, 0x00, 0x01, 0x01,
+	0x01, 0x8B, 0x02, 0x01, 0x01, 0x01, 0xBB, 0x00, 0x03, 0x00, 0x00, 0x01, 0x01, 0x81, 0x02, 0x8B, 0x03, 0x03, 0x02, 0x02, 0x01, 0x01, 0xB1, 0x00,
+	0x8B, 0x01, 0x8F, 0x00, 0x01, 0x01, 0x01, 0x81, 0x02, 0x87, 0x03, 0x81, 0x02, 0x01, 0x01, 0x01, 0x93, 0x00, 0x8B, 0x01, 0x95, 0x00, 0x01, 0x01,
+	0x01, 0x81, 0x02, 0x8D, 0x03, 0x03, 0x02, 0x02, 0x01, 0x01, 0xAF, 0x00, 0x01, 0x01, 0x01, 0x8B, 0x02, 0x01, 0x01, 0x01, 0x8B, 0x00, 0x01, 0x01,
+	0x01, 0x81, 0x02, 0x8B, 0x03, 0x81, 0x02, 0x01, 0x01, 0x01, 0x8F, 0x00, 0x01, 0x01, 0x01, 0x8B, 0x02, 0x01, 0x01, 0x01, 0x93, 0x00, 0x03, 0x01,
+	0x01, 0x02, 0x02, 0x8F, 0x03, 0x01, 0x02, 0x02, 0xB1, 0x01, 0x81, 0x02, 0x87, 0x03, 0x81, 0x02, 0x01, 0x01, 0x01, 0x89, 0x00, 0x03, 0x01, 0x01,
+	0x02, 0x02, 0x8F, 0x03, 0x01, 0x02, 0x02, 0x91, 0x01, 0x81, 0x02, 0x87, 0x03, 0x81, 0x02, 0x03, 0x01, 0x01, 0x00, 0x00, 0x8F, 0x01, 0x03, 0x01,
+	0x01, 0x02, 0x02, 0x85, 0x03, 0x87, 0x04, 0x03, 0x02, 0x02, 0x01, 0x01, 0xAB, 0x02, 0x81, 0x01, 0x01, 0x02, 0x02, 0x8B, 0x03, 0x03, 0x02, 0x02,
+	0x01, 0x01, 0x89, 0x00, 0x03, 0x01, 0x01, 0x02, 0x02, 0x85, 0x03, 0x01, 0x04, 0x04, 0x85, 0x03, 0x95, 0x02, 0x8B, 0x03, 0x01, 0x02, 0x02, 0x81,
+	0x01, 0x8D, 0x02, 0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x02, 0x02, 0x85, 0x03, 0x8D, 0x02, 0x8B, 0x03, 0x01, 0x02, 0x02, 0x97, 0x03, 0x85, 0x02,
+	0x8B, 0x03, 0x81, 0x02, 0x01, 0x01, 0x01, 0x87, 0x00, 0x03, 0x01, 0x01, 0x02, 0x02, 0x85, 0x03, 0x01, 0x02, 0x02, 0x85, 0x03, 0x01, 0x02, 0x02,
+	0x85, 0x03, 0x01, 0x02, 0x02, 0x85, 0x03, 0x81, 0x02, 0x8B, 0x03, 0x85, 0x02, 0x89, 0x03, 0x03, 0x02, 0x02, 0x01, 0x01, 0x03, 0x01, 0x01, 0x02,
+	0x02, 0x85, 0x03, 0x8B, 0x02, 0x8D, 0x03, 0x01, 0x02, 0x02, 0x99, 0x03, 0x81, 0x02, 0x8F, 0x03, 0x03, 0x02, 0x02, 0x01, 0x01, 0x87, 0x00, 0x03,
+	0x01, 0x01, 0x02, 0x02, 0x85, 0x03, 0x01, 0x02, 0x02, 0x85, 0x03, 0x01, 0x02, 0x02, 0x85, 0x03, 0x01, 0x02, 0x02, 0x85, 0x03, 0x01, 0x02, 0x02,
+	0x8F, 0x03, 0x81, 0x02, 0x8B, 0x03, 0x03, 0x02, 0x02, 0x01, 0x01, 0x03, 0x01, 0x01, 0x02, 0x02, 0x85, 0x03, 0x01, 0x02, 0x02, 0x85, 0x03, 0x81,
+	0x02, 0x8D, 0x03, 0x01, 0x02, 0x02, 0x99, 0x03, 0x81, 0x02, 0x8F, 0x03, 0x03, 0x02, 0x02, 0x01, 0x01, 0x87, 0x00, 0x03, 0x01, 0x01, 0x02, 0x02,
+	0x85, 0x03, 0x01, 0x02, 0x02, 0x85, 0x03, 0x01, 0x02, 0x02, 0x85, 0x03, 0x01, 0x02, 0x02, 0x85, 0x03, 0x01, 0x02, 0x02, 0x85, 0x03, 0x01, 0x04,
+	0x04, 0x85, 0x03, 0x81, 0x02, 0x8B, 0x03, 0x03, 0x02, 0x02, 0x01, 0x01, 0x03, 0x01, 0x01, 0x02, 0x02, 0x85, 0x03, 0x01, 0x02, 0x02, 0x85, 0x03,
+	0x01, 0x02, 0x02, 0x8F, 0x03, 0x01, 0x02, 0x02, 0x9B, 0x03, 0x01, 0x02, 0x02, 0x85, 0x03, 0x01, 0x02, 0x02, 0x85, 0x03, 0x03, 0x02, 0x02, 0x01,
+	0x01, 0x87, 0x00, 0x03, 0x01, 0x01, 0x02, 0x02, 0x85, 0x03, 0x01, 0x02, 0x02, 0x85, 0x03, 0x01, 0x02, 0x02, 0x85, 0x03, 0x01, 0x02, 0x02, 0x85,
+	0x03, 0x01, 0x02, 0x02, 0x85, 0x03, 0x01, 0x02, 0x02, 0x85, 0x03, 0x01, 0x02, 0x02, 0x8D, 0x03, 0x03, 0x02, 0x02, 0x01, 0x01, 0x03, 0x01, 0x01,
+	0x02, 0x02, 0x85, 0x03, 0x01, 0x02, 0x02, 0x85, 0x03, 0x01, 0x02, 0x02, 0x85, 0x03, 0x01, 0x04, 0x04, 0x85, 0x03, 0x01, 0x02, 0x02, 0x85, 0x03,
+	0x01, 0x04, 0x04, 0x87, 0x03, 0x01, 0x04, 0x04, 0x85, 0x03, 0x01, 0x02, 0x02, 0x85, 0x03, 0x01, 0x02, 0x02, 0x85, 0x03, 0x03, 0x02, 0x02, 0x01,
+	0x01, 0x87, 0x00, 0x03, 0x01, 0x01, 0x02, 0x02, 0x85, 0x03, 0x01, 0x02, 0x02, 0x85, 0x03, 0x01, 0x02, 0x02, 0x85, 0x03, 0x01, 0x02, 0x02, 0x85,
+	0x03, 0x01, 0x02, 0x02, 0x85, 0x03, 0x01, 0x02, 0x02, 0x85, 0x03, 0x01, 0x02, 0x02, 0x85, 0x03, 0x85, 0x04, 0x03, 0x02, 0x02, 0x01, 0x01, 0x03,
+	0x01, 0x01, 0x02, 0x02, 0x85, 0x03, 0x01, 0x02, 0x02, 0x85, 0x03, 0x01, 0x02, 0x02, 0x85, 0x03, 0x01, 0x02, 0x02, 0x85, 0x03, 0x01, 0x02, 0x02,
+	0x85, 0x03, 0x01, 0x02, 0x02, 0x87, 0x03, 0x01, 0x02, 0x02, 0x85, 0x03, 0x01, 0x02, 0x02, 0x85, 0x03, 0x01, 0x04, 0x04, 0x85, 0x03, 0x03, 0x02,
+	0x02, 0x01, 0x01, 0x87, 0x00, 0x03, 0x01, 0x01, 0x02, 0x02, 0x85, 0x03, 0x01, 0x02, 0x02, 0x85, 0x03, 0x01, 0x02, 0x02, 0x85, 0x03, 0x01, 0x02,
+	0x02, 0x85, 0x03, 0x01, 0x02, 0x02, 0x85, 0x03, 0x01, 0x02, 0x02, 0x85, 0x03, 0x01, 0x02, 0x02, 0x85, 0x03, 0x87, 0x02, 0x01, 0x01, 0x01, 0x03,
+	0x01, 0x01, 0x02, 0x02, 0x85, 0x03, 0x01, 0x02, 0x02, 0x85, 0x03, 0x01, 0x02, 0x02, 0x85, 0x03, 0x01, 0x02, 0x02, 0x85, 0x03, 0x01, 0x02, 0x02,
+	0x85, 0x03, 0x01, 0x02, 0x02, 0x87, 0x03, 0x01, 0x02, 0x02, 0x85, 0x03, 0x01, 0x02, 0x02, 0x8F, 0x03, 0x03, 0x02, 0x02, 0x01, 0x01, 0x87, 0x00,
+	0x03, 0x01, 0x01, 0x02, 0x02, 0x85, 0x03, 0x01, 0x02, 0x02, 0x85, 0x03, 0x01, 0x02, 0x02, 0x85, 0x03, 0x01, 0x02, 0x02, 0x85, 0x03, 0x01, 0x02,
+	0x02, 0x8F, 0x03, 0x01, 0x02, 0x02, 0x85, 0x03, 0x01, 0x02, 0x02, 0x87, 0x01, 0x03, 0x01, 0x01, 0x02, 0x02, 0x85, 0x03, 0x01, 0x02, 0x02, 0x85,
+	0x03, 0x01, 0x02, 0x02, 0x85, 0x03, 0x01, 0x02, 0x02, 0x85, 0x03, 0x01, 0x02, 0x02, 0x85, 0x03, 0x01, 0x02, 0x02, 0x87, 0x03, 0x01, 0x02, 0x02,
+	0x85, 0x03, 0x01, 0x02, 0x02, 0x8F, 0x03, 0x03, 0x02, 0x02, 0x01, 0x01, 0x87, 0x00, 0x03, 0x01, 0x01, 0x02, 0x02, 0x85, 0x03, 0x01, 0x02, 0x02,
+	0x85, 0x03, 0x01, 0x02, 0x02, 0x85, 0x03, 0x01, 0x02, 0x02, 0x85, 0x03, 0x01, 0x02, 0x02, 0x8F, 0x03, 0x01, 0x02, 0x02, 0x85, 0x03, 0x03, 0x02,
+	0x02, 0x01, 0x01, 0x85, 0x00, 0x03, 0x01, 0x01, 0x02, 0x02, 0x85, 0x03, 0x01, 0x02, 0x02, 0x85, 0x03, 0x01, 0x02, 0x02, 0x85, 0x03, 0x01, 0x02,
+	0x02, 0x85, 0x03, 0x01, 0x02, 0x02, 0x85, 0x03, 0x01, 0x02, 0x02, 0x87, 0x03, 0x01, 0x02, 0x02, 0x85, 0x03, 0x01, 0x02, 0x02, 0x87, 0x03, 0x85,
+	0x04, 0x03, 0x02, 0x02, 0x01, 0x01, 0x87, 0x00, 0x03, 0x01, 0x01, 0x02, 0x02, 0x85, 0x03, 0x01, 0x02, 0x02, 0x85, 0x03, 0x01, 0x02, 0x02, 0x85,
+	0x03, 0x01, 0x02, 0x02, 0x83, 0x03, 0x03, 0x04, 0x04, 0x02, 0x02, 0x87, 0x03, 0x85, 0x04, 0x01, 0x02, 0x02, 0x85, 0x03, 0x03, 0x02, 0x02, 0x01,
+	0x01, 0x85, 0x00, 0x03, 0x01, 0x01, 0x02, 0x02, 0x8F, 0x03, 0x01, 0x02, 0x02, 0x8F, 0x03, 0x01, 0x02, 0x02, 0x85, 0x03, 0x01, 0x02, 0x02, 0x87,
+	0x03, 0x01, 0x02, 0x02, 0x85, 0x03, 0x01, 0x02, 0x02, 0x87, 0x03, 0x87, 0x02, 0x01, 0x01, 0x01, 0x87, 0x00, 0x03, 0x01, 0x01, 0x02, 0x02, 0x8F,
+	0x03, 0x01, 0x02, 0x02, 0x8B, 0x03, 0x01, 0x04, 0x04, 0x81, 0x02, 0x87, 0x03, 0x87, 0x02, 0x85, 0x03, 0x03, 0x02, 0x02, 0x01, 0x01, 0x85, 0x00,
+	0x05, 0x01, 0x01, 0x02, 0x02, 0x04, 0x04, 0x8D, 0x03, 0x03, 0x02, 0x02, 0x04, 0x04, 0x8D, 0x03, 0x01, 0x02, 0x02, 0x85, 0x03, 0x01, 0x02, 0x02,
+	0x87, 0x03, 0x01, 0x02, 0x02, 0x85, 0x03, 0x03, 0x02, 0x02, 0x04, 0x04, 0x85, 0x03, 0x01, 0x02, 0x02, 0x87, 0x01, 0x87, 0x00, 0x05, 0x01, 0x01,
+	0x02, 0x02, 0x04, 0x04, 0x8B, 0x03, 0x03, 0x04, 0x04, 0x02, 0x02, 0x89, 0x03, 0x01, 0x04, 0x04, 0x83, 0x02, 0x01, 0x04, 0x04, 0x85, 0x03, 0x01,
+	0x02, 0x02, 0x83, 0x01, 0x01, 0x02, 0x02, 0x85, 0x03, 0x03, 0x02, 0x02, 0x01, 0x01, 0x85, 0x00, 0x01, 0x01, 0x01, 0x81, 0x02, 0x01, 0x04, 0x04,
+	0x8B, 0x03, 0x81, 0x02, 0x01, 0x04, 0x04, 0x8B, 0x03, 0x01, 0x02, 0x02, 0x85, 0x03, 0x01, 0x02, 0x02, 0x87, 0x03, 0x01, 0x02, 0x02, 0x85, 0x03,
+	0x81, 0x02, 0x01, 0x04, 0x04, 0x83, 0x03, 0x03, 0x02, 0x02, 0x01, 0x01, 0x8F, 0x00, 0x01, 0x01, 0x01, 0x81, 0x02, 0x01, 0x04, 0x04, 0x87, 0x03,
+	0x01, 0x04, 0x04, 0x81, 0x02, 0x87, 0x03, 0x01, 0x04, 0x04, 0x81, 0x02, 0x01, 0x01, 0x01, 0x81, 0x02, 0x01, 0x04, 0x04, 0x83, 0x03, 0x09, 0x02,
+	0x02, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x85, 0x03, 0x03, 0x02, 0x02, 0x01, 0x01, 0x85, 0x00, 0x03, 0x00, 0x00, 0x01, 0x01, 0x81,
+	0x02, 0x8B, 0x04, 0x83, 0x02, 0x8B, 0x04, 0x01, 0x02, 0x02, 0x85, 0x04, 0x01, 0x02, 0x02, 0x87, 0x04, 0x01, 0x02, 0x02, 0x85, 0x04, 0x83, 0x02,
+	0x83, 0x04, 0x03, 0x02, 0x02, 0x01, 0x01, 0x91, 0x00, 0x01, 0x01, 0x01, 0x81, 0x02, 0x87, 0x04, 0x83, 0x02, 0x87, 0x04, 0x81, 0x02, 0x05, 0x01,
+	0x01, 0x00, 0x00, 0x01, 0x01, 0x81, 0x02, 0x83, 0x04, 0x09, 0x02, 0x02, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x85, 0x04, 0x03, 0x02,
+	0x02, 0x01, 0x01, 0x85, 0x00, 0x81, 0x00, 0x01, 0x01, 0x01, 0x8F, 0x02, 0x01, 0x01, 0x01, 0xAF, 0x02, 0x01, 0x01, 0x01, 0x87, 0x02, 0x01, 0x01,
+	0x01, 0x93, 0x00, 0x01, 0x01, 0x01, 0x8B, 0x02, 0x01, 0x01, 0x01, 0x8B, 0x02, 0x01, 0x01, 0x01, 0x83, 0x00, 0x01, 0x01, 0x01, 0x87, 0x02, 0x05,
+	0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x89, 0x02, 0x01, 0x01, 0x01, 0x85, 0x00, 0x83, 0x00, 0xD1, 0x01, 0x95, 0x00, 0x9B, 0x01, 0x87, 0x00, 0x89,
+	0x01, 0x01, 0x00, 0x00, 0x8D, 0x01, 0x85, 0x00, 0xFF, 0x00, 0xBB, 0x00, 0xE5, 0x00, 0x82, 0x02, 0xA1, 0x00, 0x82, 0x02, 0xA7, 0x00, 0xA4, 0x00,
+	0x88, 0x02, 0x00, 0x00, 0x88, 0x02, 0x01, 0x00, 0x00, 0x86, 0x02, 0x00, 0x00, 0x88, 0x02, 0x00, 0x00, 0x88, 0x02, 0x84, 0x00, 0x82, 0x02, 0x01,
+	0x00, 0x00, 0x86, 0x02, 0x00, 0x00, 0x81, 0x02, 0x80, 0x00, 0x81, 0x02, 0x01, 0x00, 0x00, 0x86, 0x02, 0x01, 0x00, 0x00, 0x82, 0x02, 0xA7, 0x00,
+	0xA4, 0x00, 0x88, 0x02, 0x00, 0x00, 0x88, 0x02, 0x01, 0x00, 0x00, 0x86, 0x02, 0x00, 0x00, 0x88, 0x02, 0x00, 0x00, 0x88, 0x02, 0x84, 0x00, 0x80,
+	0x02, 0x81, 0x00, 0x86, 0x02, 0x00, 0x00, 0x81, 0x02, 0x80, 0x00, 0x81, 0x02, 0x01, 0x00, 0x00, 0x86, 0x02, 0x81, 0x00, 0x80, 0x02, 0xA7, 0x00,
+	0xA4, 0x00, 0x81, 0x02, 0x80, 0x00, 0x81, 0x02, 0x00, 0x00, 0x81, 0x02, 0x80, 0x00, 0x81, 0x02, 0x01, 0x00, 0x00, 0x81, 0x02, 0x83, 0x00, 0x81,
+	0x02, 0x85, 0x00, 0x81, 0x02, 0x8B, 0x00, 0x80, 0x02, 0x81, 0x00, 0x81, 0x02, 0x83, 0x00, 0x81, 0x02, 0x80, 0x00, 0x81, 0x02, 0x01, 0x00, 0x00,
+	0x81, 0x02, 0x86, 0x00, 0x80, 0x02, 0xA7, 0x00, 0xA4, 0x00, 0x81, 0x02, 0x80, 0x00, 0x81, 0x02, 0x00, 0x00, 0x81, 0x02, 0x80, 0x00, 0x81, 0x02,
+	0x01, 0x00, 0x00, 0x81, 0x02, 0x83, 0x00, 0x88, 0x02, 0x00, 0x00, 0x88, 0x02, 0x84, 0x00, 0x80, 0x02, 0x81, 0x00, 0x81, 0x02, 0x83, 0x00, 0x81,
+	0x02, 0x80, 0x00, 0x81, 0x02, 0x01, 0x00, 0x00, 0x81, 0x02, 0x86, 0x00, 0x80, 0x02, 0xA7, 0x00, 0xA4, 0x00, 0x88, 0x02, 0x00, 0x00, 0x86, 0x02,
+	0x81, 0x00, 0x86, 0x02, 0x00, 0x00, 0x88, 0x02, 0x00, 0x00, 0x88, 0x02, 0x84, 0x00, 0x80, 0x02, 0x81, 0x00, 0x86, 0x02, 0x80, 0x00, 0x84, 0x02,
+	0x81, 0x00, 0x86, 0x02, 0x81, 0x00, 0x80, 0x02, 0xA7, 0x00, 0xA4, 0x00, 0x81, 0x02, 0x85, 0x00, 0x81, 0x02, 0x80, 0x00, 0x81, 0x02, 0x01, 0x00,
+	0x00, 0x81, 0x02, 0x8A, 0x00, 0x81, 0x02, 0x85, 0x00, 0x81, 0x02, 0x84, 0x00, 0x80, 0x02, 0x81, 0x00, 0x81, 0x02, 0x83, 0x00, 0x81, 0x02, 0x80,
+	0x00, 0x81, 0x02, 0x01, 0x00, 0x00, 0x81, 0x02, 0x86, 0x00, 0x80, 0x02, 0xA7, 0x00, 0xA4, 0x00, 0x81, 0x02, 0x85, 0x00, 0x81, 0x02, 0x80, 0x00,
+	0x81, 0x02, 0x01, 0x00, 0x00, 0x86, 0x02, 0x00, 0x00, 0x88, 0x02, 0x00, 0x00, 0x88, 0x02, 0x84, 0x00, 0x80, 0x02, 0x81, 0x00, 0x86, 0x02, 0x00,
+	0x00, 0x81, 0x02, 0x80, 0x00, 0x81, 0x02, 0x01, 0x00, 0x00, 0x86, 0x02, 0x81, 0x00, 0x80, 0x02, 0xA7, 0x00, 0xA4, 0x00, 0x81, 0x02, 0x85, 0x00,
+	0x81, 0x02, 0x80, 0x00, 0x81, 0x02, 0x01, 0x00, 0x00, 0x86, 0x02, 0x00, 0x00, 0x88, 0x02, 0x00, 0x00, 0x88, 0x02, 0x84, 0x00, 0x80, 0x02, 0x81,
+	0x00, 0x86, 0x02, 0x00, 0x00, 0x81, 0x02, 0x80, 0x00, 0x81, 0x02, 0x01, 0x00, 0x00, 0x86, 0x02, 0x01, 0x00, 0x00, 0x82, 0x02, 0xA7, 0x00, 0xA4,
+	0x00, 0x81, 0x02, 0x85, 0x00, 0x81, 0x02, 0x80, 0x00, 0x81, 0x02, 0x01, 0x00, 0x00, 0x86, 0x02, 0x00, 0x00, 0x88, 0x02, 0x00, 0x00, 0x88, 0x02,
+	0x84, 0x00, 0x82, 0x02, 0x01, 0x00, 0x00, 0x86, 0x02, 0x00, 0x00, 0x81, 0x02, 0x80, 0x00, 0x81, 0x02, 0x01, 0x00, 0x00, 0x86, 0x02, 0x01, 0x00,
+	0x00, 0x82, 0x02, 0xA7, 0x00, 0xA1, 0x00, 0x88, 0x02, 0x00, 0x00, 0x88, 0x02, 0x83, 0x00, 0x88, 0x02, 0x00, 0x00, 0x88, 0x02, 0x00, 0x00, 0x88,
+	0x02, 0x00, 0x00, 0x88, 0x02, 0x00, 0x00, 0x81, 0x02, 0x00, 0x00, 0x88, 0x02, 0x00, 0x00, 0x81, 0x02, 0x80, 0x00, 0x81, 0x02, 0x01, 0x00, 0x00,
+	0x86, 0x02, 0xA5, 0x00, 0xA5, 0x00, 0x81, 0x02, 0x81, 0x00, 0x81, 0x02, 0x80, 0x00, 0x81, 0x02, 0x83, 0x00, 0x81, 0x02, 0x80, 0x00, 0x81, 0x02,
+	0x00, 0x00, 0x81, 0x02, 0x80, 0x00, 0x81, 0x02, 0x00, 0x00, 0x81, 0x02, 0x80, 0x00, 0x81, 0x02, 0x82, 0x00, 0x81, 0x02, 0x81, 0x00, 0x81, 0x02,
+	0x00, 0x00, 0x81, 0x02, 0x80, 0x00, 0x81, 0x02, 0x00, 0x00, 0x81, 0x02, 0x80, 0x00, 0x81, 0x02, 0x01, 0x00, 0x00, 0x81, 0x02, 0xAA, 0x00, 0xA5,
+	0x00, 0x81, 0x02, 0x81, 0x00, 0x81, 0x02, 0x80, 0x00, 0x81, 0x02, 0x83, 0x00, 0x81, 0x02, 0x85, 0x00, 0x81, 0x02, 0x80, 0x00, 0x81, 0x02, 0x00,
+	0x00, 0x81, 0x02, 0x80, 0x00, 0x81, 0x02, 0x82, 0x00, 0x81, 0x02, 0x81, 0x00, 0x81, 0x02, 0x00, 0x00, 0x81, 0x02, 0x80, 0x00, 0x81, 0x02, 0x00,
+	0x00, 0x81, 0x02, 0x80, 0x00, 0x81, 0x02, 0x01, 0x00, 0x00, 0x86, 0x02, 0xA5, 0x00, 0xA5, 0x00, 0x81, 0x02, 0x81, 0x00, 0x88, 0x02, 0x83, 0x00,
+	0x88, 0x02, 0x00, 0x00, 0x88, 0x02, 0x00, 0x00, 0x81, 0x02, 0x80, 0x00, 0x81, 0x02, 0x82, 0x00, 0x81, 0x02, 0x81, 0x00, 0x81, 0x02, 0x00, 0x00,
+	0x81, 0x02, 0x80, 0x00, 0x81, 0x02, 0x00, 0x00, 0x88, 0x02, 0x01, 0x00, 0x00, 0x86, 0x02, 0xA5, 0x00,
+};
+const uint32_t embedded_gameover_row_offsets[] = {
+	0, 0, 10, 10, 32, 32, 70, 70, 118, 118, 166, 166, 222, 222, 284, 284, 347, 347, 420, 420, 501, 501, 599, 599,
+	695, 695, 781, 781, 869, 869, 963, 963, 1032, 1032, 1120, 1120, 1218, 1218, 1301, 1301, 1357, 1357, 1376, 1376, 1376, 1376, 1376, 1376,
+	1376, 1376, 1376, 1376, 1376, 1376, 1376, 1376, 1376, 1380, 1390, 1390, 1440, 1488, 1488, 1488, 1488, 1544, 1600, 1600, 1600, 1642, 1642, 1642,
+	1642, 1694, 1746, 1799, 1380, 1380, 1376, 1376, 1376, 1376, 1853, 1853, 1853, 1900, 1900, 1900, 1900, 1900, 1967, 1967, 1967, 1900, 1900, 1900,
+	1900, 2030, 2030, 2030,
+};
+const uint32_t embedded_gameover_row_spans[] = {
+	0, 2, 4, 6, 8, 12, 16, 20, 24, 27, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56,
+	58, 60, 62, 64, 66, 68, 70, 72, 74, 76, 78, 81, 84, 88, 92, 96, 100, 104, 108, 108, 108, 108, 108, 108,
+	108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 110, 121, 132, 143, 156, 169, 182, 195, 208, 218, 228, 238, 250, 262,
+	274, 286, 298, 310, 322, 324, 326, 326, 326, 326, 326, 337, 348, 359, 375, 391, 407, 423, 439, 454, 469, 484, 500, 516,
+	532, 548, 560, 572, 584,
+};
+const TextureSpan embedded_gameover_spans[] = {
+	{6, 20}, {114, 14}, {6, 20}, {114, 14}, {4, 22}, {112, 18}, {4, 22}, {112, 18}, {2, 24}, {78, 14}, {110, 22}, {154, 14},
+	{2, 24}, {78, 14}, {110, 22}, {154, 14}, {0, 26}, {76, 18}, {108, 26}, {152, 18}, {0, 26}, {76, 18}, {108, 26}, {152, 18},
+	{0, 96}, {108, 64}, {174, 18}, {0, 96}, {108, 64}, {174, 18}, {0, 96}, {108, 84}, {0, 96}, {108, 84}, {0, 98}, {108, 84},
+	{0, 98}, {108, 84}, {0, 98}, {108, 84}, {0, 98}, {108, 84}, {0, 98}, {108, 84}, {0, 98}, {108, 84}, {0, 98}, {108, 84},
+	{0, 98}, {108, 84}, {0, 98}, {108, 84}, {0, 98}, {108, 84}, {0, 98}, {108, 84}, {0, 98}, {108, 84}, {0, 98}, {108, 84},
+	{0, 98}, {108, 84}, {0, 98}, {108, 76}, {0, 98}, {108, 76}, {0, 98}, {108, 76}, {0, 98}, {108, 76}, {0, 98}, {108, 76},
+	{0, 98}, {108, 76}, {0, 98}, {108, 76}, {0, 98}, {108, 76}, {0, 90}, {108, 58}, {168, 16}, {0, 90}, {108, 58}, {168, 16},
+	{2, 88}, {110, 38}, {150, 16}, {168, 16}, {2, 88}, {110, 38}, {150, 16}, {168, 16}, {4, 86}, {112, 34}, {152, 14}, {168, 16},
+	{4, 86}, {112, 34}, {152, 14}, {168, 16}, {6, 84}, {114, 30}, {154, 12}, {168, 16}, {6, 84}, {114, 30}, {154, 12}, {168, 16},
+	{104, 5}, {145, 5}, {39, 11}, {51, 11}, {64, 9}, {74, 11}, {86, 11}, {104, 5}, {111, 9}, {121, 4}, {128, 4}, {134, 9},
+	{145, 5}, {39, 11}, {51, 11}, {64, 9}, {74, 11}, {86, 11}, {104, 5}, {111, 9}, {121, 4}, {128, 4}, {134, 9}, {145, 5},
+	{39, 11}, {51, 11}, {64, 9}, {74, 11}, {86, 11}, {104, 3}, {111, 9}, {121, 4}, {128, 4}, {134, 9}, {147, 3}, {39, 4},
+	{46, 4}, {51, 4}, {58, 4}, {64, 4}, {74, 4}, {86, 4}, {104, 3}, {111, 4}, {121, 4}, {128, 4}, {134, 4}, {147, 3},
+	{39, 4}, {46, 4}, {51, 4}, {58, 4}, {64, 4}, {74, 4}, {86, 4}, {104, 3}, {111, 4}, {121, 4}, {128, 4}, {134, 4},
+	{147, 3}, {39, 4}, {46, 4}, {51, 4}, {58, 4}, {64, 4}, {74, 4}, {86, 4}, {104, 3}, {111, 4}, {121, 4}, {128, 4},
+	{134, 4}, {147, 3}, {39, 4}, {46, 4}, {51, 4}, {58, 4}, {64, 4}, {74, 4}, {86, 4}, {104, 3}, {111, 4}, {121, 4},
+	{128, 4}, {134, 4}, {147, 3}, {39, 4}, {46, 4}, {51, 4}, {58, 4}, {64, 4}, {74, 11}, {86, 11}, {104, 3}, {111, 4},
+	{121, 4}, {128, 4}, {134, 4}, {147, 3}, {39, 11}, {51, 9}, {64, 9}, {74, 11}, {86, 11}, {104, 3}, {111, 9}, {123, 7},
+	{134, 9}, {147, 3}, {39, 11}, {51, 9}, {64, 9}, {74, 11}, {86, 11}, {104, 3}, {111, 9}, {123, 7}, {134, 9}, {147, 3},
+	{39, 11}, {51, 9}, {64, 9}, {74, 11}, {86, 11}, {104, 3}, {111, 9}, {123, 7}, {134, 9}, {147, 3}, {39, 4}, {51, 4},
+	{58, 4}, {64, 4}, {81, 4}, {93, 4}, {104, 3}, {111, 4}, {121, 4}, {128, 4}, {134, 4}, {147, 3}, {39, 4}, {51, 4},
+	{58, 4}, {64, 4}, {81, 4}, {93, 4}, {104, 3}, {111, 4}, {121, 4}, {128, 4}, {134, 4}, {147, 3}, {39, 4}, {51, 4},
+	{58, 4}, {64, 4}, {81, 4}, {93, 4}, {104, 3}, {111, 4}, {121, 4}, {128, 4}, {134, 4}, {147, 3}, {39, 4}, {51, 4},
+	{58, 4}, {64, 4}, {81, 4}, {93, 4}, {104, 3}, {111, 4}, {121, 4}, {128, 4}, {134, 4}, {147, 3}, {39, 4}, {51, 4},
+	{58, 4}, {64, 9}, {74, 11}, {86, 11}, {104, 3}, {111, 9}, {121, 4}, {128, 4}, {134, 9}, {147, 3}, {39, 4}, {51, 4},
+	{58, 4}, {64, 9}, {74, 11}, {86, 11}, {104, 3}, {111, 9}, {121, 4}, {128, 4}, {134, 9}, {145, 5}, {39, 4}, {51, 4},
+	{58, 4}, {64, 9}, {74, 11}, {86, 11}, {104, 5}, {111, 9}, {121, 4}, {128, 4}, {134, 9}, {145, 5}, {104, 5}, {145, 5},
+	{104, 5}, {145, 5}, {36, 11}, {48, 11}, {65, 11}, {77, 11}, {89, 11}, {101, 11}, {113, 4}, {118, 11}, {130, 4}, {137, 4},
+	{143, 9}, {36, 11}, {48, 11}, {65, 11}, {77, 11}, {89, 11}, {101, 11}, {113, 4}, {118, 11}, {130, 4}, {137, 4}, {143, 9},
+	{36, 11}, {48, 11}, {65, 11}, {77, 11}, {89, 11}, {101, 11}, {113, 4}, {118, 11}, {130, 4}, {137, 4}, {143, 9}, {40, 4},
+	{48, 4}, {55, 4}, {65, 4}, {72, 4}, {77, 4}, {84, 4}, {89, 4}, {96, 4}, {105, 4}, {113, 4}, {118, 4}, {125, 4},
+	{130, 4}, {137, 4}, {143, 4}, {40, 4}, {48, 4}, {55, 4}, {65, 4}, {72, 4}, {77, 4}, {84, 4}, {89, 4}, {96, 4},
+	{105, 4}, {113, 4}, {118, 4}, {125, 4}, {130, 4}, {137, 4}, {143, 4}, {40, 4}, {48, 4}, {55, 4}, {65, 4}, {72, 4},
+	{77, 4}, {84, 4}, {89, 4}, {96, 4}, {105, 4}, {113, 4}, {118, 4}, {125, 4}, {130, 4}, {137, 4}, {143, 4}, {40, 4},
+	{48, 4}, {55, 4}, {65, 4}, {72, 4}, {77, 4}, {84, 4}, {89, 4}, {96, 4}, {105, 4}, {113, 4}, {118, 4}, {125, 4},
+	{130, 4}, {137, 4}, {143, 4}, {40, 4}, {48, 4}, {55, 4}, {65, 4}, {72, 4}, {77, 4}, {84, 4}, {89, 4}, {96, 4},
+	{105, 4}, {113, 4}, {118, 4}, {125, 4}, {130, 4}, {137, 4}, {143, 4}, {40, 4}, {48, 4}, {55, 4}, {65, 4}, {77, 4},
+	{84, 4}, {89, 4}, {96, 4}, {105, 4}, {113, 4}, {118, 4}, {125, 4}, {130, 4}, {137, 4}, {143, 9}, {40, 4}, {48, 4},
+	{55, 4}, {65, 4}, {77, 4}, {84, 4}, {89, 4}, {96, 4}, {105, 4}, {113, 4}, {118, 4}, {125, 4}, {130, 4}, {137, 4},
+	{143, 9}, {40, 4}, {48, 4}, {55, 4}, {65, 4}, {77, 4}, {84, 4}, {89, 4}, {96, 4}, {105, 4}, {113, 4}, {118, 4},
+	{125, 4}, {130, 4}, {137, 4}, {143, 9}, {40, 4}, {48, 4}, {55, 4}, {65, 4}, {72, 4}, {77, 4}, {84, 4}, {89, 4},
+	{96, 4}, {105, 4}, {113, 4}, {118, 4}, {125, 4}, {130, 4}, {137, 4}, {143, 4}, {40, 4}, {48, 4}, {55, 4}, {65, 4},
+	{72, 4}, {77, 4}, {84, 4}, {89, 4}, {96, 4}, {105, 4}, {113, 4}, {118, 4}, {125, 4}, {130, 4}, {137, 4}, {143, 4},
+	{40, 4}, {48, 4}, {55, 4}, {65, 4}, {72, 4}, {77, 4}, {84, 4}, {89, 4}, {96, 4}, {105, 4}, {113, 4}, {118, 4},
+	{125, 4}, {130, 4}, {137, 4}, {143, 4}, {40, 4}, {48, 4}, {55, 4}, {65, 4}, {72, 4}, {77, 4}, {84, 4}, {89, 4},
+	{96, 4}, {105, 4}, {113, 4}, {118, 4}, {125, 4}, {130, 4}, {137, 4}, {143, 4}, {40, 4}, {48, 11}, {65, 11}, {77, 11},
+	{89, 4}, {96, 4}, {105, 4}, {113, 4}, {118, 4}, {125, 4}, {130, 11}, {143, 9}, {40, 4}, {48, 11}, {65, 11}, {77, 11},
+	{89, 4}, {96, 4}, {105, 4}, {113, 4}, {118, 4}, {125, 4}, {130, 11}, {143, 9}, {40, 4}, {48, 11}, {65, 11}, {77, 11},
+	{89, 4}, {96, 4}, {105, 4}, {113, 4}, {118, 4}, {125, 4}, {130, 11}, {143, 9},
+};
+Texture embedded_gameover = {192, 100, TEXTURE_RLE8, 0, embedded_gameover_palette, embedded_gameover_texels, embedded_gameover_row_offsets, 0, 0, 0, embedded_gameover_row_spans, embedded_gameover_spans, 0};
+
+// pipe0: 52x26 TEXTURE_RLE8, 643 byte file
+const uint16_t embedded_pipe0_palette[] = {
+	0xF81F, 0x51C8, 0xC6EE, 0xCF2E, 0xD76F, 0xDF90, 0xDFD0, 0xE7F1, 0xDFB0, 0xB6AD, 0xAE6C, 0xA60B, 0x95CA, 0x8D89, 0x8548, 0x7CE7, 0x74C6, 0x6C85, 0x6445, 0x5C24, 0x5404, 0xDFD1, 0xA62B, 0x9DCA,
+	0x7D07, 0x74A6, 0x6485, 0x6CA6, 0x6C86, 0xCF2F, 0x6486, 0xE7D0, 0x8528, 0x6CC6,
+};
+const uint8_t embedded_pipe0_texels[] = {
+	0xB1, 0x01, 0x33, 0x01, 0x01, 0x02, 0x02, 0x03, 0x03, 0x04, 0x04, 0x05, 0x05, 0x06, 0x06, 0x07, 0x07, 0x06, 0x06, 0x08, 0x08, 0x04, 0x04, 0x05,
+	0x05, 0x04, 0x04, 0x03, 0x03, 0x02, 0x02, 0x09, 0x09, 0x0A, 0x0A, 0x0B, 0x0B, 0x0C, 0x0C, 0x0D, 0x0D, 0x0E, 0x0E, 0x0F, 0x0F, 0x10, 0x10, 0x11,
+	0x11, 0x12, 0x12, 0x13, 0x13, 0x01, 0x01, 0x29, 0x01, 0x01, 0x04, 0x04, 0x08, 0x08, 0x06, 0x06, 0x07, 0x07, 0x06, 0x06, 0x05, 0x05, 0x04, 0x04,
+	0x03, 0x03, 0x02, 0x02, 0x09, 0x09, 0x0A, 0x0A, 0x0B, 0x0B, 0x0C, 0x0C, 0x0D, 0x0D, 0x0E, 0x0E, 0x0F, 0x0F, 0x10, 0x10, 0x11, 0x11, 0x12, 0x12,
+	0x13, 0x13, 0x85, 0x14, 0x01, 0x01, 0x01, 0x29, 0x01, 0x01, 0x04, 0x04, 0x05, 0x05, 0x06, 0x06, 0x07, 0x07, 0x15, 0x15, 0x08, 0x08, 0x04, 0x04,
+	0x03, 0x03, 0x02, 0x02, 0x09, 0x09, 0x0A, 0x0A, 0x16, 0x16, 0x17, 0x17, 0x0D, 0x0D, 0x0E, 0x0E, 0x18, 0x18, 0x19, 0x19, 0x1A, 0x1A, 0x12, 0x12,
+	0x13, 0x13, 0x85, 0x14, 0x01, 0x01, 0x01, 0x29, 0x01, 0x01, 0x04, 0x04, 0x08, 0x08, 0x06, 0x06, 0x07, 0x07, 0x06, 0x06, 0x05, 0x05, 0x04, 0x04,
+	0x03, 0x03, 0x02, 0x02, 0x09, 0x09, 0x0A, 0x0A, 0x0B, 0x0B, 0x17, 0x17, 0x0D, 0x0D, 0x0E, 0x0E, 0x18, 0x18, 0x1B, 0x1B, 0x1C, 0x1C, 0x12, 0x12,
+	0x13, 0x13, 0x85, 0x14, 0x01, 0x01, 0x01, 0x29, 0x01, 0x01, 0x04, 0x04, 0x05, 0x05, 0x06, 0x06, 0x07, 0x07, 0x06, 0x06, 0x08, 0x08, 0x04, 0x04,
+	0x03, 0x03, 0x02, 0x02, 0x09, 0x09, 0x0A, 0x0A, 0x0B, 0x0B, 0x17, 0x17, 0x0D, 0x0D, 0x0E, 0x0E, 0x18, 0x18, 0x19, 0x19, 0x1C, 0x1C, 0x12, 0x12,
+	0x13, 0x13, 0x85, 0x14, 0x01, 0x01, 0x01, 0x29, 0x01, 0x01, 0x04, 0x04, 0x05, 0x05, 0x06, 0x06, 0x07, 0x07, 0x06, 0x06, 0x08, 0x08, 0x04, 0x04,
+	0x1D, 0x1D, 0x02, 0x02, 0x09, 0x09, 0x0A, 0x0A, 0x0B, 0x0B, 0x17, 0x17, 0x0D, 0x0D, 0x0E, 0x0E, 0x0F, 0x0F, 0x10, 0x10, 0x1E, 0x1E, 0x12, 0x12,
+	0x13, 0x13, 0x85, 0x14, 0x01, 0x01, 0x01, 0x29, 0x01, 0x01, 0x04, 0x04, 0x05, 0x05, 0x1F, 0x1F, 0x07, 0x07, 0x1F, 0x1F, 0x05, 0x05, 0x04, 0x04,
+	0x03, 0x03, 0x02, 0x02, 0x09, 0x09, 0x0A, 0x0A, 0x0B, 0x0B, 0x0C, 0x0C, 0x0D, 0x0D, 0x0E, 0x0E, 0x18, 0x18, 0x19, 0x19, 0x1C, 0x1C, 0x12, 0x12,
+	0x13, 0x13, 0x85, 0x14, 0x01, 0x01, 0x01, 0x29, 0x01, 0x01, 0x04, 0x04, 0x05, 0x05, 0x06, 0x06, 0x07, 0x07, 0x15, 0x15, 0x05, 0x05, 0x04, 0x04,
+	0x1D, 0x1D, 0x02, 0x02, 0x09, 0x09, 0x0A, 0x0A, 0x0B, 0x0B, 0x17, 0x17, 0x0D, 0x0D, 0x0E, 0x0E, 0x0F, 0x0F, 0x19, 0x19, 0x1C, 0x1C, 0x12, 0x12,
+	0x13, 0x13, 0x85, 0x14, 0x01, 0x01, 0x01, 0x29, 0x01, 0x01, 0x04, 0x04, 0x05, 0x05, 0x15, 0x15, 0x07, 0x07, 0x06, 0x06, 0x05, 0x05, 0x04, 0x04,
+	0x03, 0x03, 0x02, 0x02, 0x09, 0x09, 0x0A, 0x0A, 0x0B, 0x0B, 0x0C, 0x0C, 0x0D, 0x0D, 0x20, 0x20, 0x18, 0x18, 0x21, 0x21, 0x1C, 0x1C, 0x12, 0x12,
+	0x13, 0x13, 0x85, 0x14, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xAD, 0x14, 0x01, 0x01, 0x01, 0x03, 0x00, 0x00, 0x01, 0x01, 0xA9, 0x14, 0x03, 0x01,
+	0x01, 0x00, 0x00,
+};
+const uint32_t embedded_pipe0_row_offsets[] = {
+	0, 0, 2, 2, 55, 55, 103, 103, 151, 151, 199, 199, 247, 247, 295, 295, 343, 343, 391, 391, 439, 439, 0, 0,
+	447, 447,
+};
+const uint32_t embedded_pipe0_row_spans[] = {
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23,
+	24, 25, 26,
+};
+const TextureSpan embedded_pipe0_spans[] = {
+	{0, 52}, {0, 52}, {0, 52}, {0, 52}, {0, 52}, {0, 52}, {0, 52}, {0, 52}, {0, 52}, {0, 52}, {0, 52}, {0, 52},
+	{0, 52}, {0, 52}, {0, 52}, {0, 52}, {0, 52}, {0, 52}, {0, 52}, {0, 52}, {0, 52}, {0, 52}, {0, 52}, {0, 52},
+	{2, 48}, {2, 48},
+};
+Texture embedded_pipe0 = {52, 26, TEXTURE_RLE8, 0, embedded_pipe0_palette, embedded_pipe0_texels, embedded_pipe0_row_offsets, 0, 0, 0, embedded_pipe0_row_spans, embedded_pipe0_spans, 0};
+
+// pipe0_body: 52x1 TEXTURE_INDEXED4, 66 byte file
+const uint16_t embedded_pipe0_body_palette[] = {
+	0xF81F, 0x51C8, 0x8548, 0x95AA, 0xA62B, 0xB6AD, 0xC70E, 0xD76F, 0xDFB0, 0xE7F1, 0xB68D, 0x95CA, 0x74E7, 0x6C86, 0x5C25, 0x5404,
+};
+const uint8_t embedded_pipe0_body_texels[] = {
+	0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0x88, 0x77, 0x66, 0xAA, 0x44, 0xBB, 0x22, 0xCC, 0xDD, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF,
+	0x11, 0x00,
+};
+const uint32_t embedded_pipe0_body_row_spans[] = {
+	0, 1,
+};
+const TextureSpan embedded_pipe0_body_spans[] = {
+	{2, 48},
+};
+Texture embedded_pipe0_body = {52, 1, TEXTURE_INDEXED4, 26, embedded_pipe0_body_palette, embedded_pipe0_body_texels, 0, 0, 0, 0, embedded_pipe0_body_row_spans, embedded_pipe0_body_spans, 0};
+
+// pipe1: 52x26 TEXTURE_RLE8, 643 byte file
+const uint16_t embedded_pipe1_palette[] = {
+	0xF81F, 0x51C8, 0x5404, 0xD76F, 0xDF90, 0xDFD1, 0xE7F1, 0xDFD0, 0xCF2E, 0xC6EE, 0xB6AD, 0xAE6C, 0xA60B, 0x95CA, 0x8D89, 0x8528, 0x7D07, 0x6CC6, 0x6C86, 0x6445, 0x5C24, 0xCF2F, 0x9DCA, 0x8548,
+	0x7CE7, 0x74A6, 0xE7D0, 0xDFB0, 0x74C6, 0x6486, 0x6CA6, 0xA62B, 0x6485, 0x6C85,
+};
+const uint8_t embedded_pipe1_texels[] = {
+	0x03, 0x00, 0x00, 0x01, 0x01, 0xA9, 0x02, 0x03, 0x01, 0x01, 0x00, 0x00, 0xB1, 0x01, 0x01, 0x01, 0x01, 0xAD, 0x02, 0x01, 0x01, 0x01, 0x29, 0x01,
+	0x01, 0x03, 0x03, 0x04, 0x04, 0x05, 0x05, 0x06, 0x06, 0x07, 0x07, 0x04, 0x04, 0x03, 0x03, 0x08, 0x08, 0x09, 0x09, 0x0A, 0x0A, 0x0B, 0x0B, 0x0C,
+	0x0C, 0x0D, 0x0D, 0x0E, 0x0E, 0x0F, 0x0F, 0x10, 0x10, 0x11, 0x11, 0x12, 0x12, 0x13, 0x13, 0x14, 0x14, 0x85, 0x02, 0x01, 0x01, 0x01, 0x29, 0x01,
+	0x01, 0x03, 0x03, 0x04, 0x04, 0x07, 0x07, 0x06, 0x06, 0x05, 0x05, 0x04, 0x04, 0x03, 0x03, 0x15, 0x15, 0x09, 0x09, 0x0A, 0x0A, 0x0B, 0x0B, 0x0C,
+	0x0C, 0x16, 0x16, 0x0E, 0x0E, 0x17, 0x17, 0x18, 0x18, 0x19, 0x19, 0x12, 0x12, 0x13, 0x13, 0x14, 0x14, 0x85, 0x02, 0x01, 0x01, 0x01, 0x29, 0x01,
+	0x01, 0x03, 0x03, 0x04, 0x04, 0x1A, 0x1A, 0x06, 0x06, 0x1A, 0x1A, 0x04, 0x04, 0x03, 0x03, 0x08, 0x08, 0x09, 0x09, 0x0A, 0x0A, 0x0B, 0x0B, 0x0C,
+	0x0C, 0x0D, 0x0D, 0x0E, 0x0E, 0x17, 0x17, 0x10, 0x10, 0x19, 0x19, 0x12, 0x12, 0x13, 0x13, 0x14, 0x14, 0x85, 0x02, 0x01, 0x01, 0x01, 0x29, 0x01,
+	0x01, 0x03, 0x03, 0x04, 0x04, 0x07, 0x07, 0x06, 0x06, 0x07, 0x07, 0x1B, 0x1B, 0x03, 0x03, 0x15, 0x15, 0x09, 0x09, 0x0A, 0x0A, 0x0B, 0x0B, 0x0C,
+	0x0C, 0x16, 0x16, 0x0E, 0x0E, 0x17, 0x17, 0x18, 0x18, 0x1C, 0x1C, 0x1D, 0x1D, 0x13, 0x13, 0x14, 0x14, 0x85, 0x02, 0x01, 0x01, 0x01, 0x29, 0x01,
+	0x01, 0x03, 0x03, 0x04, 0x04, 0x07, 0x07, 0x06, 0x06, 0x07, 0x07, 0x1B, 0x1B, 0x03, 0x03, 0x08, 0x08, 0x09, 0x09, 0x0A, 0x0A, 0x0B, 0x0B, 0x0C,
+	0x0C, 0x16, 0x16, 0x0E, 0x0E, 0x17, 0x17, 0x10, 0x10, 0x19, 0x19, 0x12, 0x12, 0x13, 0x13, 0x14, 0x14, 0x85, 0x02, 0x01, 0x01, 0x01, 0x29, 0x01,
+	0x01, 0x03, 0x03, 0x1B, 0x1B, 0x07, 0x07, 0x06, 0x06, 0x07, 0x07, 0x04, 0x04, 0x03, 0x03, 0x08, 0x08, 0x09, 0x09, 0x0A, 0x0A, 0x0B, 0x0B, 0x0C,
+	0x0C, 0x16, 0x16, 0x0E, 0x0E, 0x17, 0x17, 0x10, 0x10, 0x1E, 0x1E, 0x12, 0x12, 0x13, 0x13, 0x14, 0x14, 0x85, 0x02, 0x01, 0x01, 0x01, 0x29, 0x01,
+	0x01, 0x03, 0x03, 0x04, 0x04, 0x07, 0x07, 0x06, 0x06, 0x05, 0x05, 0x1B, 0x1B, 0x03, 0x03, 0x08, 0x08, 0x09, 0x09, 0x0A, 0x0A, 0x0B, 0x0B, 0x1F,
+	0x1F, 0x16, 0x16, 0x0E, 0x0E, 0x17, 0x17, 0x10, 0x10, 0x19, 0x19, 0x20, 0x20, 0x13, 0x13, 0x14, 0x14, 0x85, 0x02, 0x01, 0x01, 0x01, 0x29, 0x01,
+	0x01, 0x03, 0x03, 0x1B, 0x1B, 0x07, 0x07, 0x06, 0x06, 0x07, 0x07, 0x04, 0x04, 0x03, 0x03, 0x08, 0x08, 0x09, 0x09, 0x0A, 0x0A, 0x0B, 0x0B, 0x0C,
+	0x0C, 0x0D, 0x0D, 0x0E, 0x0E, 0x17, 0x17, 0x18, 0x18, 0x1C, 0x1C, 0x21, 0x21, 0x13, 0x13, 0x14, 0x14, 0x85, 0x02, 0x01, 0x01, 0x01, 0x33, 0x01,
+	0x01, 0x09, 0x09, 0x08, 0x08, 0x03, 0x03, 0x04, 0x04, 0x07, 0x07, 0x06, 0x06, 0x07, 0x07, 0x1B, 0x1B, 0x03, 0x03, 0x04, 0x04, 0x03, 0x03, 0x08,
+	0x08, 0x09, 0x09, 0x0A, 0x0A, 0x0B, 0x0B, 0x0C, 0x0C, 0x0D, 0x0D, 0x0E, 0x0E, 0x17, 0x17, 0x18, 0x18, 0x1C, 0x1C, 0x21, 0x21, 0x13, 0x13, 0x14,
+	0x14, 0x01, 0x01,
+};
+const uint32_t embedded_pipe1_row_offsets[] = {
+	0, 0, 12, 12, 14, 14, 22, 22, 70, 70, 118, 118, 166, 166, 214, 214, 262, 262, 310, 310, 358, 358, 406, 406,
+	12, 12,
+};
+const uint32_t embedded_pipe1_row_spans[] = {
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23,
+	24, 25, 26,
+};
+const TextureSpan embedded_pipe1_spans[] = {
+	{2, 48}, {2, 48}, {0, 52}, {0, 52}, {0, 52}, {0, 52}, {0, 52}, {0, 52}, {0, 52}, {0, 52}, {0, 52}, {0, 52},
+	{0, 52}, {0, 52}, {0, 52}, {0, 52}, {0, 52}, {0, 52}, {0, 52}, {0, 52}, {0, 52}, {0, 52}, {0, 52}, {0, 52},
+	{0, 52}, {0, 52},
+};
+Texture embedded_pipe1 = {52, 26, TEXTURE_RLE8, 0, embedded_pipe1_palette, embedded_pipe1_texels, embedded_pipe1_row_offsets, 0, 0, 0, embedded_pipe1_row_spans, embedded_pipe1_spans, 0};
+
+// pipe1_body: 52x1 TEXTURE_INDEXED4, 66 byte file
+const uint16_t embedded_pipe1_body_palette[] = {
+	0xF81F, 0x51C8, 0x8548, 0x95AA, 0xA62B, 0xB6AD, 0xC70E, 0xD76F, 0xDFB0, 0xE7F1, 0xB68D, 0x95CA, 0x74E7, 0x6C86, 0x5C25, 0x5404,
+};
+const uint8_t embedded_pipe1_body_texels[] = {
+	0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0x88, 0x77, 0x66, 0xAA, 0x44, 0xBB, 0x22, 0xCC, 0xDD, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF,
+	0x11, 0x00,
+};
+const uint32_t embedded_pipe1_body_row_spans[] = {
+	0, 1,
+};
+const TextureSpan embedded_pipe1_body_spans[] = {
+	{2, 48},
+};
+Texture embedded_pipe1_body = {52, 1, TEXTURE_INDEXED4, 26, embedded_pipe1_body_palette, embedded_pipe1_body_texels, 0, 0, 0, 0, embedded_pipe1_body_row_spans, embedded_pipe1_body_spans, 0};
+
+// fnt/5x6: 5x6 glyphs
+const uint16_t embedded_fnt_5x6_row_runs[] = {
+	0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 3, 4, 4, 6, 8, 8, 8, 8, 8, 10, 11, 13, 14, 16,
+	16, 17, 18, 19, 20, 21, 22, 24, 25, 26, 27, 29, 29, 30, 31, 33, 35, 37, 37, 38, 39, 39, 39, 39,
+	39, 40, 41, 42, 43, 44, 44, 45, 46, 47, 48, 49, 49, 51, 52, 54, 54, 54, 54, 55, 56, 57, 58, 59,
+	59, 59, 59, 59, 59, 60, 61, 61, 61, 62, 62, 62, 62, 62, 62, 62, 62, 63, 63, 64, 65, 66, 67, 68,
+	68, 69, 71, 74, 76, 77, 77, 78, 79, 80, 81, 82, 82, 83, 84, 85, 86, 87, 87, 88, 89, 90, 91, 92,
+	92, 93, 95, 97, 98, 99, 99, 100, 101, 102, 103, 104, 104, 105, 106, 107, 109, 110, 110, 111, 112, 113, 114, 115,
+	115, 116, 118, 119, 121, 122, 122, 123, 125, 126, 127, 128, 128, 128, 129, 129, 129, 130, 130, 130, 131, 131, 131, 132,
+	133, 134, 135, 136, 137, 138, 138, 138, 139, 139, 140, 140, 140, 141, 142, 143, 144, 145, 145, 146, 148, 149, 149, 150,
+	150, 151, 153, 155, 156, 157, 157, 158, 160, 162, 163, 165, 165, 166, 168, 169, 171, 172, 172, 173, 174, 175, 176, 177,
+	177, 178, 180, 182, 184, 185, 185, 186, 187, 188, 189, 190, 190, 191, 192, 193, 194, 195, 195, 196, 197, 199, 201, 202,
+	202, 204, 206, 207, 209, 211, 211, 212, 213, 214, 215, 216, 216, 217, 218, 219, 221, 222, 222, 224, 226, 227, 229, 231,
+	231, 232, 233, 234, 235, 236, 236, 238, 240, 243, 245, 247, 247, 249, 251, 254, 256, 258, 258, 259, 261, 263, 265, 266,
+	266, 267, 269, 270, 271, 272, 272, 273, 275, 278, 280, 282, 282, 283, 285, 286, 288, 290, 290, 291, 292, 293, 294, 295,
+	295, 296, 297, 298, 299, 300, 300, 302, 304, 306, 308, 309, 309, 311, 313, 315, 317, 318, 318, 320, 322, 325, 327, 329,
+	329, 331, 333, 334, 336, 338, 338, 340, 342, 343, 344, 345, 345, 346, 347, 348, 349, 350, 350, 351, 352, 353, 354, 355,
+	355, 356, 357, 358, 359, 360, 360, 361, 362, 363, 364, 365, 365, 366, 368, 368, 368, 368, 368, 368, 368, 368, 368, 369,
+	369, 370, 371, 371, 371, 371, 371, 371, 372, 374, 376, 377, 377, 378, 379, 381, 383, 384, 384, 384, 385, 386, 387, 388,
+	388, 389, 390, 392, 394, 395, 395, 395, 396, 397, 398, 399, 399, 400, 401, 402, 403, 404, 404, 404, 405, 407, 408, 409,
+	410, 411, 412, 414, 416, 418, 418, 419, 419, 420, 421, 422, 422, 423, 423, 424, 425, 426, 427, 428, 430, 431, 433, 435,
+	435, 436, 437, 438, 439, 440, 440, 440, 441, 444, 447, 450, 450, 450, 451, 453, 455, 457, 457, 457, 458, 460, 462, 463,
+	463, 463, 464, 466, 467, 468, 469, 469, 470, 472, 473, 474, 475, 475, 476, 477, 478, 479, 479, 479, 480, 481, 482, 483,
+	483, 484, 485, 486, 487, 488, 488, 488, 490, 492, 494, 495, 495, 495, 497, 499, 501, 502, 502, 502, 505, 508, 511, 512,
+	512, 512, 514, 515, 517, 519, 519, 519, 521, 523, 524, 525, 526, 526, 527, 528, 529, 530, 530, 531, 532, 533, 534, 535,
+	535, 536, 537, 538, 539, 540, 540, 541, 542, 543, 544, 545, 545, 545, 545, 547, 549, 549, 549,
+};
+const GlyphRun embedded_fnt_5x6_runs[] = {
+	{2, 1}, {2, 1}, {2, 1}, {2, 1}, {1, 1}, {3, 1}, {1, 1}, {3, 1}, {1, 1}, {3, 1}, {0, 5}, {1, 1},
+	{3, 1}, {0, 5}, {1, 1}, {3, 1}, {2, 1}, {1, 3}, {1, 2}, {2, 2}, {1, 3}, {2, 1}, {1, 1}, {4, 1},
+	{3, 1}, {2, 1}, {1, 1}, {0, 1}, {3, 1}, {0, 2}, {1, 1}, {0, 1}, {2, 3}, {0, 1}, {3, 1}, {0, 3},
+	{4, 1}, {2, 1}, {2, 1}, {3, 1}, {2, 1}, {2, 1}, {2, 1}, {3, 1}, {1, 1}, {2, 1}, {2, 1}, {2, 1},
+	{1, 1}, {1, 1}, {3, 1}, {2, 1}, {1, 1}, {3, 1}, {2, 1}, {2, 1}, {0, 5}, {2, 1}, {2, 1}, {2, 1},
+	{2, 1}, {0, 5}, {2, 1}, {4, 1}, {3, 1}, {2, 1}, {1, 1}, {0, 1}, {1, 3}, {0, 1}, {3, 2}, {0, 1},
+	{2, 1}, {4, 1}, {0, 2}, {4, 1}, {1, 3}, {2, 1}, {1, 2}, {2, 1}, {2, 1}, {0, 5}, {0, 4}, {4, 1},
+	{0, 5}, {0, 1}, {0, 5}, {0, 4}, {4, 1}, {1, 3}, {4, 1}, {0, 4}, {2, 2}, {1, 1}, {3, 1}, {0, 1},
+	{3, 1}, {0, 5}, {3, 1}, {0, 5}, {0, 1}, {0, 5}, {4, 1}, {0, 4}, {1, 3}, {0, 1}, {0, 4}, {0, 1},
+	{4, 1}, {1, 3}, {0, 5}, {4, 1}, {3, 1}, {2, 1}, {2, 1}, {1, 3}, {0, 1}, {4, 1}, {1, 3}, {0, 1},
+	{4, 1}, {1, 3}, {1, 3}, {0, 1}, {4, 1}, {1, 4}, {4, 1}, {1, 3}, {2, 1}, {2, 1}, {2, 1}, {2, 1},
+	{2, 1}, {3, 1}, {2, 1}, {1, 1}, {2, 1}, {3, 1}, {0, 5}, {0, 5}, {1, 1}, {2, 1}, {3, 1}, {2, 1},
+	{1, 1}, {1, 3}, {0, 1}, {4, 1}, {2, 2}, {2, 1}, {0, 5}, {0, 1}, {4, 1}, {0, 1}, {2, 3}, {0, 1},
+	{0, 5}, {1, 3}, {0, 1}, {4, 1}, {0, 1}, {4, 1}, {0, 5}, {0, 1}, {4, 1}, {0, 4}, {0, 1}, {4, 1},
+	{0, 4}, {0, 1}, {4, 1}, {0, 4}, {1, 4}, {0, 1}, {0, 1}, {0, 1}, {1, 4}, {0, 4}, {0, 1}, {4, 1},
+	{0, 1}, {4, 1}, {0, 1}, {4, 1}, {0, 4}, {0, 5}, {0, 1}, {0, 4}, {0, 1}, {0, 5}, {0, 5}, {0, 1},
+	{0, 4}, {0, 1}, {0, 1}, {1, 4}, {0, 1}, {0, 1}, {3, 2}, {0, 1}, {4, 1}, {1, 4}, {0, 1}, {4, 1},
+	{0, 1}, {4, 1}, {0, 5}, {0, 1}, {4, 1}, {0, 1}, {4, 1}, {0, 5}, {2, 1}, {2, 1}, {2, 1}, {0, 5},
+	{1, 4}, {4, 1}, {4, 1}, {0, 1}, {4, 1}, {1, 3}, {0, 1}, {4, 1}, {0, 1}, {3, 1}, {0, 3}, {0, 1},
+	{3, 1}, {0, 1}, {4, 1}, {0, 1}, {0, 1}, {0, 1}, {0, 1}, {0, 5}, {0, 1}, {4, 1}, {0, 2}, {3, 2},
+	{0, 1}, {2, 1}, {4, 1}, {0, 1}, {4, 1}, {0, 1}, {4, 1}, {0, 1}, {4, 1}, {0, 2}, {4, 1}, {0, 1},
+	{2, 1}, {4, 1}, {0, 1}, {3, 2}, {0, 1}, {4, 1}, {1, 3}, {0, 1}, {4, 1}, {0, 1}, {4, 1}, {0, 1},
+	{4, 1}, {1, 3}, {0, 4}, {0, 1}, {4, 1}, {0, 4}, {0, 1}, {0, 1}, {1, 3}, {0, 1}, {4, 1}, {0, 1},
+	{2, 1}, {4, 1}, {0, 1}, {3, 1}, {1, 2}, {4, 1}, {0, 4}, {0, 1}, {4, 1}, {0, 4}, {0, 1}, {4, 1},
+	{0, 1}, {4, 1}, {1, 4}, {0, 1}, {0, 5}, {4, 1}, {0, 4}, {0, 5}, {2, 1}, {2, 1}, {2, 1}, {2, 1},
+	{0, 1}, {4, 1}, {0, 1}, {4, 1}, {0, 1}, {4, 1}, {0, 1}, {4, 1}, {1, 3}, {0, 1}, {4, 1}, {0, 1},
+	{4, 1}, {1, 1}, {3, 1}, {1, 1}, {3, 1}, {2, 1}, {0, 1}, {4, 1}, {0, 1}, {4, 1}, {0, 1}, {2, 1},
+	{4, 1}, {0, 2}, {3, 2}, {0, 1}, {4, 1}, {0, 1}, {4, 1}, {1, 1}, {3, 1}, {2, 1}, {1, 1}, {3, 1},
+	{0, 1}, {4, 1}, {0, 1}, {4, 1}, {1, 1}, {3, 1}, {2, 1}, {2, 1}, {2, 1}, {0, 5}, {3, 1}, {2, 1},
+	{1, 1}, {0, 5}, {2, 2}, {2, 1}, {2, 1}, {2, 1}, {2, 2}, {0, 1}, {1, 1}, {2, 1}, {3, 1}, {4, 1},
+	{1, 2}, {2, 1}, {2, 1}, {2, 1}, {1, 2}, {2, 1}, {1, 1}, {3, 1}, {0, 5}, {1, 1}, {2, 1}, {1, 3},
+	{0, 1}, {3, 1}, {0, 1}, {3, 1}, {1, 4}, {0, 1}, {0, 4}, {0, 1}, {4, 1}, {0, 1}, {4, 1}, {0, 4},
+	{1, 4}, {0, 1}, {0, 1}, {1, 4}, {4, 1}, {1, 4}, {0, 1}, {4, 1}, {0, 1}, {4, 1}, {1, 4}, {1, 3},
+	{0, 5}, {0, 1}, {1, 4}, {2, 3}, {1, 1}, {0, 5}, {1, 1}, {1, 1}, {1, 4}, {0, 1}, {4, 1}, {1, 4},
+	{4, 1}, {1, 3}, {0, 1}, {0, 4}, {0, 1}, {4, 1}, {0, 1}, {4, 1}, {0, 1}, {4, 1}, {2, 1}, {1, 2},
+	{2, 1}, {1, 3}, {3, 1}, {2, 2}, {3, 1}, {3, 1}, {1, 2}, {0, 1}, {0, 1}, {4, 1}, {0, 4}, {0, 1},
+	{4, 1}, {0, 1}, {4, 1}, {1, 2}, {2, 1}, {2, 1}, {2, 1}, {1, 3}, {0, 4}, {0, 1}, {2, 1}, {4, 1},
+	{0, 1}, {2, 1}, {4, 1}, {0, 1}, {2, 1}, {4, 1}, {0, 4}, {0, 1}, {4, 1}, {0, 1}, {4, 1}, {0, 1},
+	{4, 1}, {1, 3}, {0, 1}, {4, 1}, {0, 1}, {4, 1}, {1, 3}, {0, 4}, {0, 1}, {4, 1}, {0, 4}, {0, 1},
+	{0, 1}, {1, 4}, {0, 1}, {4, 1}, {1, 4}, {4, 1}, {4, 1}, {1, 4}, {0, 1}, {0, 1}, {0, 1}, {2, 3},
+	{2, 1}, {2, 1}, {0, 3}, {1, 1}, {0, 5}, {1, 1}, {1, 1}, {2, 3}, {0, 1}, {4, 1}, {0, 1}, {4, 1},
+	{0, 1}, {4, 1}, {1, 4}, {0, 1}, {4, 1}, {0, 1}, {4, 1}, {1, 1}, {3, 1}, {2, 1}, {0, 1}, {2, 1},
+	{4, 1}, {0, 1}, {2, 1}, {4, 1}, {0, 1}, {2, 1}, {4, 1}, {1, 4}, {0, 1}, {4, 1}, {1, 3}, {0, 1},
+	{4, 1}, {0, 1}, {4, 1}, {0, 1}, {4, 1}, {0, 1}, {4, 1}, {1, 4}, {4, 1}, {1, 3}, {0, 3}, {2, 1},
+	{2, 1}, {2, 3}, {3, 1}, {2, 1}, {1, 2}, {2, 1}, {3, 1}, {2, 1}, {2, 1}, {2, 1}, {2, 1}, {2, 1},
+	{1, 1}, {2, 1}, {2, 2}, {2, 1}, {1, 1}, {1, 2}, {4, 1}, {0, 1}, {2, 2},
+};
+Font embedded_fnt_5x6 = {5, 6, embedded_fnt_5x6_row_runs, embedded_fnt_5x6_runs};
+
+// fnt/7x8: 7x8 glyphs
+const uint16_t embedded_fnt_7x8_row_runs[] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 4, 5, 5, 6, 6, 8, 10, 10, 10, 10, 10, 10,
+	10, 12, 13, 15, 17, 19, 20, 22, 22, 23, 24, 25, 26, 27, 28, 29, 29, 31, 33, 34, 35, 36, 38, 40,
+	40, 41, 43, 44, 47, 49, 52, 54, 54, 55, 56, 56, 56, 56, 56, 56, 56, 57, 58, 59, 60, 61, 62, 63,
+	63, 64, 65, 66, 67, 68, 69, 70, 70, 72, 73, 75, 75, 75, 75, 75, 75, 75, 76, 77, 78, 79, 80, 80,
+	80, 80, 80, 80, 80, 80, 80, 81, 82, 82, 82, 82, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 84,
+	84, 85, 86, 87, 88, 89, 90, 91, 91, 92, 94, 97, 100, 103, 105, 106, 106, 107, 108, 109, 110, 111, 112, 113,
+	113, 114, 116, 117, 118, 119, 120, 121, 121, 122, 124, 125, 126, 127, 129, 130, 130, 131, 133, 135, 137, 138, 139, 140,
+	140, 141, 142, 143, 144, 145, 147, 148, 148, 149, 150, 151, 152, 154, 156, 157, 157, 158, 159, 160, 161, 162, 163, 164,
+	164, 165, 167, 169, 170, 172, 174, 175, 175, 176, 178, 180, 181, 182, 183, 184, 184, 184, 184, 185, 185, 185, 185, 186,
+	186, 186, 186, 187, 187, 187, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 196, 196, 196, 197, 197, 198, 198, 198,
+	198, 199, 200, 201, 202, 203, 204, 205, 205, 206, 208, 209, 210, 211, 211, 212, 212, 213, 215, 218, 222, 224, 225, 226,
+	226, 227, 229, 231, 233, 234, 236, 238, 238, 239, 241, 243, 244, 246, 248, 249, 249, 250, 252, 253, 254, 255, 257, 258,
+	258, 259, 261, 263, 265, 267, 269, 270, 270, 271, 272, 273, 274, 275, 276, 277, 277, 278, 279, 280, 281, 282, 283, 284,
+	284, 285, 287, 288, 290, 292, 294, 295, 295, 297, 299, 301, 302, 304, 306, 308, 308, 309, 310, 311, 312, 313, 314, 315,
+	315, 316, 317, 318, 319, 320, 322, 323, 323, 325, 327, 329, 330, 332, 334, 336, 336, 337, 338, 339, 340, 341, 342, 343,
+	343, 345, 347, 351, 354, 356, 358, 360, 360, 362, 364, 367, 370, 373, 375, 377, 377, 378, 380, 382, 384, 386, 388, 389,
+	389, 390, 392, 394, 396, 397, 398, 399, 399, 400, 402, 404, 407, 410, 412, 414, 414, 415, 417, 419, 420, 422, 424, 426,
+	426, 427, 429, 430, 431, 432, 434, 435, 435, 436, 437, 438, 439, 440, 441, 442, 442, 444, 446, 448, 450, 452, 454, 455,
+	455, 457, 459, 461, 463, 465, 467, 468, 468, 470, 472, 474, 477, 481, 483, 485, 485, 487, 489, 491, 492, 494, 496, 498,
+	498, 500, 502, 504, 505, 506, 507, 508, 508, 509, 510, 511, 512, 513, 514, 515, 515, 516, 517, 518, 519, 520, 521, 522,
+	522, 523, 524, 525, 526, 527, 528, 529, 529, 530, 531, 532, 533, 534, 535, 536, 536, 537, 539, 541, 541, 541, 541, 541,
+	541, 541, 541, 541, 541, 541, 541, 542, 542, 543, 544, 544, 544, 544, 544, 544, 544, 544, 544, 545, 546, 547, 549, 550,
+	550, 551, 552, 554, 556, 558, 560, 561, 561, 561, 561, 562, 563, 564, 565, 566, 566, 567, 568, 569, 571, 573, 575, 576,
+	576, 576, 576, 577, 579, 580, 581, 582, 582, 583, 584, 585, 586, 587, 588, 589, 589, 589, 589, 590, 592, 594, 595, 596,
+	597, 598, 599, 601, 603, 605, 607, 609, 609, 610, 610, 611, 612, 613, 614, 615, 615, 616, 616, 617, 618, 619, 620, 621,
+	622, 623, 624, 626, 628, 629, 631, 633, 633, 634, 635, 636, 637, 638, 639, 640, 640, 640, 640, 641, 644, 647, 650, 653,
+	653, 653, 653, 655, 657, 659, 661, 663, 663, 663, 663, 664, 666, 668, 670, 671, 671, 671, 671, 673, 675, 677, 678, 679,
+	680, 680, 680, 681, 683, 685, 686, 687, 688, 688, 688, 690, 692, 693, 694, 695, 695, 695, 695, 696, 697, 698, 699, 700,
+	700, 700, 701, 702, 703, 704, 705, 706, 706, 706, 706, 708, 710, 712, 714, 715, 715, 715, 715, 717, 719, 721, 723, 724,
+	724, 724, 724, 726, 729, 732, 735, 736, 736, 736, 736, 738, 740, 741, 743, 745, 745, 745, 745, 747, 749, 751, 752, 753,
+	754, 754, 754, 755, 756, 757, 758, 759, 759, 760, 761, 762, 763, 764, 765, 766, 766, 767, 768, 769, 770, 771, 772, 773,
+	773, 774, 775, 776, 777, 778, 779, 780, 780, 780, 780, 780, 781, 784, 785, 785, 785,
+};
+const GlyphRun embedded_fnt_7x8_runs[] = {
+	{3, 1}, {3, 1}, {3, 1}, {3, 1}, {3, 1}, {3, 1}, {2, 1}, {4, 1}, {2, 1}, {4, 1}, {1, 1}, {5, 1},
+	{0, 7}, {1, 1}, {5, 1}, {1, 1}, {5, 1}, {1, 1}, {5, 1}, {0, 7}, {1, 1}, {5, 1}, {3, 1}, {1, 6},
+	{0, 1}, {1, 5}, {6, 1}, {0, 6}, {3, 1}, {1, 1}, {6, 1}, {1, 1}, {5, 1}, {4, 1}, {3, 1}, {2, 1},
+	{1, 1}, {5, 1}, {0, 1}, {5, 1}, {2, 1}, {1, 1}, {3, 1}, {2, 1}, {1, 1}, {3, 1}, {5, 1}, {0, 1},
+	{4, 1}, {0, 1}, {3, 1}, {5, 1}, {1, 2}, {6, 1}, {3, 1}, {3, 1}, {4, 1}, {3, 1}, {2, 1}, {2, 1},
+	{2, 1}, {3, 1}, {4, 1}, {2, 1}, {3, 1}, {4, 1}, {4, 1}, {4, 1}, {3, 1}, {2, 1}, {2, 1}, {4, 1},
+	{3, 1}, {2, 1}, {4, 1}, {3, 1}, {3, 1}, {1, 5}, {3, 1}, {3, 1}, {3, 1}, {2, 2}, {1, 5}, {3, 1},
+	{6, 1}, {5, 1}, {4, 1}, {3, 1}, {2, 1}, {1, 1}, {0, 1}, {2, 3}, {1, 1}, {5, 1}, {0, 1}, {4, 1},
+	{6, 1}, {0, 1}, {3, 1}, {6, 1}, {0, 1}, {2, 1}, {6, 1}, {1, 1}, {5, 1}, {2, 3}, {3, 1}, {2, 2},
+	{3, 1}, {3, 1}, {3, 1}, {3, 1}, {0, 7}, {1, 5}, {0, 1}, {6, 1}, {6, 1}, {4, 2}, {1, 3}, {0, 1},
+	{0, 7}, {1, 5}, {0, 1}, {6, 1}, {6, 1}, {2, 4}, {6, 1}, {0, 1}, {6, 1}, {1, 5}, {3, 3}, {2, 1},
+	{5, 1}, {1, 1}, {5, 1}, {0, 1}, {5, 1}, {0, 7}, {5, 1}, {5, 1}, {0, 7}, {0, 1}, {0, 6}, {6, 1},
+	{6, 1}, {0, 1}, {6, 1}, {1, 5}, {2, 4}, {1, 1}, {0, 1}, {0, 6}, {0, 1}, {6, 1}, {0, 1}, {6, 1},
+	{1, 5}, {0, 7}, {6, 1}, {5, 1}, {4, 1}, {4, 1}, {3, 1}, {3, 1}, {1, 5}, {0, 1}, {6, 1}, {0, 1},
+	{6, 1}, {1, 5}, {0, 1}, {6, 1}, {0, 1}, {6, 1}, {1, 5}, {1, 5}, {0, 1}, {6, 1}, {0, 1}, {6, 1},
+	{1, 6}, {6, 1}, {5, 1}, {1, 4}, {3, 1}, {3, 1}, {3, 1}, {3, 1}, {2, 2}, {4, 1}, {3, 1}, {2, 1},
+	{1, 1}, {2, 1}, {3, 1}, {4, 1}, {1, 5}, {1, 5}, {2, 1}, {3, 1}, {4, 1}, {5, 1}, {4, 1}, {3, 1},
+	{2, 1}, {2, 4}, {1, 1}, {6, 1}, {6, 1}, {3, 3}, {3, 1}, {3, 1}, {1, 5}, {0, 1}, {6, 1}, {0, 1},
+	{3, 2}, {6, 1}, {0, 1}, {2, 1}, {4, 1}, {6, 1}, {0, 1}, {2, 5}, {0, 1}, {1, 5}, {2, 3}, {1, 1},
+	{5, 1}, {0, 1}, {6, 1}, {0, 1}, {6, 1}, {0, 7}, {0, 1}, {6, 1}, {0, 1}, {6, 1}, {0, 6}, {0, 1},
+	{6, 1}, {0, 1}, {6, 1}, {0, 6}, {0, 1}, {6, 1}, {0, 1}, {6, 1}, {0, 6}, {1, 5}, {0, 1}, {6, 1},
+	{0, 1}, {0, 1}, {0, 1}, {0, 1}, {6, 1}, {1, 5}, {0, 5}, {0, 1}, {5, 1}, {0, 1}, {6, 1}, {0, 1},
+	{6, 1}, {0, 1}, {6, 1}, {0, 1}, {5, 1}, {0, 5}, {0, 7}, {0, 1}, {0, 1}, {0, 5}, {0, 1}, {0, 1},
+	{0, 7}, {0, 7}, {0, 1}, {0, 1}, {0, 5}, {0, 1}, {0, 1}, {0, 1}, {1, 5}, {0, 1}, {6, 1}, {0, 1},
+	{0, 1}, {3, 4}, {0, 1}, {6, 1}, {0, 1}, {6, 1}, {1, 6}, {0, 1}, {6, 1}, {0, 1}, {6, 1}, {0, 1},
+	{6, 1}, {0, 7}, {0, 1}, {6, 1}, {0, 1}, {6, 1}, {0, 1}, {6, 1}, {0, 7}, {3, 1}, {3, 1}, {3, 1},
+	{3, 1}, {3, 1}, {0, 7}, {1, 6}, {6, 1}, {6, 1}, {6, 1}, {6, 1}, {0, 1}, {6, 1}, {1, 5}, {0, 1},
+	{6, 1}, {0, 1}, {5, 1}, {0, 1}, {4, 1}, {0, 4}, {0, 1}, {4, 1}, {0, 1}, {5, 1}, {0, 1}, {6, 1},
+	{0, 1}, {0, 1}, {0, 1}, {0, 1}, {0, 1}, {0, 1}, {0, 7}, {0, 1}, {6, 1}, {0, 2}, {5, 2}, {0, 1},
+	{2, 1}, {4, 1}, {6, 1}, {0, 1}, {3, 1}, {6, 1}, {0, 1}, {6, 1}, {0, 1}, {6, 1}, {0, 1}, {6, 1},
+	{0, 1}, {6, 1}, {0, 2}, {6, 1}, {0, 1}, {2, 1}, {6, 1}, {0, 1}, {3, 1}, {6, 1}, {0, 1}, {4, 1},
+	{6, 1}, {0, 1}, {5, 2}, {0, 1}, {6, 1}, {1, 5}, {0, 1}, {6, 1}, {0, 1}, {6, 1}, {0, 1}, {6, 1},
+	{0, 1}, {6, 1}, {0, 1}, {6, 1}, {1, 5}, {0, 6}, {0, 1}, {6, 1}, {0, 1}, {6, 1}, {0, 1}, {6, 1},
+	{0, 6}, {0, 1}, {0, 1}, {1, 5}, {0, 1}, {6, 1}, {0, 1}, {6, 1}, {0, 1}, {3, 1}, {6, 1}, {0, 1},
+	{4, 1}, {6, 1}, {0, 1}, {5, 1}, {1, 4}, {6, 1}, {0, 6}, {0, 1}, {6, 1}, {0, 1}, {6, 1}, {0, 6},
+	{0, 1}, {6, 1}, {0, 1}, {6, 1}, {0, 1}, {6, 1}, {1, 5}, {0, 1}, {6, 1}, {0, 1}, {1, 5}, {6, 1},
+	{0, 1}, {6, 1}, {1, 5}, {0, 7}, {3, 1}, {3, 1}, {3, 1}, {3, 1}, {3, 1}, {3, 1}, {0, 1}, {6, 1},
+	{0, 1}, {6, 1}, {0, 1}, {6, 1}, {0, 1}, {6, 1}, {0, 1}, {6, 1}, {0, 1}, {6, 1}, {1, 5}, {0, 1},
+	{6, 1}, {0, 1}, {6, 1}, {1, 1}, {5, 1}, {1, 1}, {5, 1}, {2, 1}, {4, 1}, {2, 1}, {4, 1}, {3, 1},
+	{0, 1}, {6, 1}, {0, 1}, {6, 1}, {0, 1}, {6, 1}, {0, 1}, {3, 1}, {6, 1}, {0, 1}, {2, 1}, {4, 1},
+	{6, 1}, {0, 2}, {5, 2}, {0, 1}, {6, 1}, {0, 1}, {6, 1}, {1, 1}, {5, 1}, {2, 1}, {4, 1}, {3, 1},
+	{2, 1}, {4, 1}, {1, 1}, {5, 1}, {0, 1}, {6, 1}, {0, 1}, {6, 1}, {1, 1}, {5, 1}, {2, 1}, {4, 1},
+	{3, 1}, {3, 1}, {3, 1}, {3, 1}, {0, 7}, {5, 1}, {4, 1}, {3, 1}, {2, 1}, {1, 1}, {0, 7}, {2, 3},
+	{2, 1}, {2, 1}, {2, 1}, {2, 1}, {2, 1}, {2, 3}, {0, 1}, {1, 1}, {2, 1}, {3, 1}, {4, 1}, {5, 1},
+	{6, 1}, {2, 3}, {4, 1}, {4, 1}, {4, 1}, {4, 1}, {4, 1}, {2, 3}, {3, 1}, {2, 1}, {4, 1}, {1, 1},
+	{5, 1}, {1, 5}, {1, 2}, {3, 1}, {1, 5}, {6, 1}, {1, 6}, {0, 1}, {6, 1}, {1, 6}, {0, 1}, {0, 1},
+	{0, 1}, {2, 4}, {0, 2}, {6, 1}, {0, 1}, {6, 1}, {0, 1}, {6, 1}, {0, 6}, {1, 6}, {0, 1}, {0, 1},
+	{0, 1}, {1, 6}, {6, 1}, {6, 1}, {1, 6}, {0, 1}, {6, 1}, {0, 1}, {6, 1}, {0, 1}, {6, 1}, {1, 6},
+	{1, 5}, {0, 1}, {6, 1}, {0, 7}, {0, 1}, {1, 6}, {3, 4}, {2, 1}, {0, 7}, {2, 1}, {2, 1}, {2, 1},
+	{2, 1}, {1, 6}, {0, 1}, {6, 1}, {0, 1}, {6, 1}, {1, 6}, {6, 1}, {1, 5}, {0, 1}, {0, 1}, {0, 1},
+	{2, 4}, {0, 2}, {6, 1}, {0, 1}, {6, 1}, {0, 1}, {6, 1}, {0, 1}, {6, 1}, {3, 1}, {1, 3}, {3, 1},
+	{3, 1}, {3, 1}, {1, 5}, {4, 1}, {2, 3}, {4, 1}, {4, 1}, {4, 1}, {4, 1}, {1, 3}, {0, 1}, {0, 1},
+	{0, 1}, {6, 1}, {0, 1}, {5, 1}, {0, 5}, {0, 1}, {5, 1}, {0, 1}, {6, 1}, {1, 3}, {3, 1}, {3, 1},
+	{3, 1}, {3, 1}, {3, 1}, {1, 5}, {0, 6}, {0, 1}, {3, 1}, {6, 1}, {0, 1}, {3, 1}, {6, 1}, {0, 1},
+	{3, 1}, {6, 1}, {0, 1}, {3, 1}, {6, 1}, {0, 1}, {2, 4}, {0, 2}, {6, 1}, {0, 1}, {6, 1}, {0, 1},
+	{6, 1}, {0, 1}, {6, 1}, {1, 5}, {0, 1}, {6, 1}, {0, 1}, {6, 1}, {0, 1}, {6, 1}, {1, 5}, {0, 1},
+	{2, 4}, {0, 2}, {6, 1}, {0, 1}, {6, 1}, {0, 6}, {0, 1}, {0, 1}, {1, 6}, {0, 1}, {6, 1}, {0, 1},
+	{6, 1}, {1, 6}, {6, 1}, {6, 1}, {0, 1}, {2, 4}, {0, 2}, {6, 1}, {0, 1}, {0, 1}, {0, 1}, {1, 6},
+	{0, 1}, {1, 5}, {6, 1}, {0, 6}, {2, 1}, {0, 7}, {2, 1}, {2, 1}, {2, 1}, {3, 4}, {0, 1}, {6, 1},
+	{0, 1}, {6, 1}, {0, 1}, {6, 1}, {0, 1}, {6, 1}, {1, 6}, {0, 1}, {6, 1}, {0, 1}, {6, 1}, {1, 1},
+	{5, 1}, {2, 1}, {4, 1}, {3, 1}, {0, 1}, {6, 1}, {0, 1}, {3, 1}, {6, 1}, {0, 1}, {3, 1}, {6, 1},
+	{0, 1}, {3, 1}, {6, 1}, {1, 6}, {0, 1}, {6, 1}, {1, 1}, {5, 1}, {2, 3}, {1, 1}, {5, 1}, {0, 1},
+	{6, 1}, {0, 1}, {6, 1}, {0, 1}, {6, 1}, {0, 1}, {6, 1}, {1, 6}, {6, 1}, {1, 5}, {0, 7}, {6, 1},
+	{1, 5}, {0, 1}, {0, 7}, {4, 1}, {3, 1}, {3, 1}, {2, 1}, {3, 1}, {3, 1}, {4, 1}, {3, 1}, {3, 1},
+	{3, 1}, {3, 1}, {3, 1}, {3, 1}, {3, 1}, {2, 1}, {3, 1}, {3, 1}, {4, 1}, {3, 1}, {3, 1}, {2, 1},
+	{1, 2}, {0, 1}, {3, 1}, {6, 1}, {4, 2},
+};
+Font embedded_fnt_7x8 = {7, 8, embedded_fnt_7x8_row_runs, embedded_fnt_7x8_runs};
+
+const EmbeddedAsset embeddedAssets[] = {
+	{"background", &embedded_background, 0},
+	{"flappy0", &embedded_flappy0, 0},
+	{"flappy1", &embedded_flappy1, 0},
+	{"flappy2", &embedded_flappy2, 0},
+	{"gameover", &embedded_gameover, 0},
+	{"pipe0", &embedded_pipe0, 0},
+	{"pipe0_body", &embedded_pipe0_body, 0},
+	{"pipe1", &embedded_pipe1, 0},
+	{"pipe1_body", &embedded_pipe1_body, 0},
+	{"fnt/5x6", 0, &embedded_fnt_5x6},
+	{"fnt/7x8", 0, &embedded_fnt_7x8},
+};
+const uint16_t embeddedAssetCount = 11;
@@ -0,0 +1,74 @@
+// fill_functions.hpp
+
+// Fill and copy kernels for rgb565 pixels that store two pixels per 32-bit word
+// A single pixel is written first when the destination isn't word aligned and one more at the end when the count is odd
+// The word loops are unrolled to 8 bytes per iteration, the sh4 has no 64-bit integer stores
+
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+// lets the kernels write uint16_t buffers through 32-bit pointers without breaking strict aliasing
+typedef uint32_t __attribute__((__may_alias__)) pixel_pair_t;
+
+inline void rgb565_fill(uint16_t *dst, uint32_t count, uint16_t color) {
+	if (count == 0) return;
+	if ((uintptr_t)dst & 2) {
+		*dst++ = color;
+		count--;
+	}
+	uint32_t pair = ((uint32_t)color << 16) | color;
+	pixel_pair_t *words = (pixel_pair_t*)dst;
+	uint32_t n = count >> 1;
+	for (; n >= 2; n -= 2) {
+		words[0] = pair;
+		words[1] = pair;
+		words += 2;
+	}
+	if (n) *words++ = pair;
+	if (count & 1) *(uint16_t*)words = color;
+}
+
+inline void rgb565_copy(uint16_t *dst, const uint16_t *src, uint32_t count) {
+	if (((uintptr_t)dst ^ (uintptr_t)src) & 2) {
+		// only one of them can ever be word aligned
+		memcpy(dst, src, count*2);
+		return;
+	}
+	if (count == 0) return;
+	if ((uintptr_t)dst & 2) {
+		*dst++ = *src++;
+		count--;
+	}
+	pixel_pair_t *d = (pixel_pair_t*)dst;
+	const pixel_pair_t *s = (const pixel_pair_t*)src;
+	uint32_t n = count >> 1;
+	for (; n >= 2; n -= 2) {
+		d[0] = s[0];
+		d[1] = s[1];
+		d += 2;
+		s += 2;
+	}
+	if (n) *d++ = *s++;
+	if (count & 1) *(uint16_t*)d = *(const uint16_t*)s;
+}
+
+// rectangles of w x h pixels, strides are in pixels
+inline void rgb565_fill_rect(uint16_t *dst, uint32_t stride, uint32_t w, uint32_t h, uint16_t color) {
+	if (w == stride) {
+		rgb565_fill(dst, w*h, color);
+		return;
+	}
+	for (uint32_t j = 0; j < h; j++, dst += stride)
+		rgb565_fill(dst, w, color);
+}
+
+inline void rgb565_copy_rect(uint16_t *dst, uint32_t dstStride, const uint16_t *src, uint32_t srcStride, uint32_t w, uint32_t h) {
+	if (w == dstStride && w == srcStride) {
+		rgb565_copy(dst, src, w*h);
+		return;
+	}
+	for (uint32_t j = 0; j < h; j++, dst += dstStride, src += srcStride)
+		rgb565_copy(dst, src, w);
+}
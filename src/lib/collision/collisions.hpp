@@ -10,3 +10,4 @@
 
 #include "box.hpp"
 #include "circle.hpp"
+#include "mask.hpp"
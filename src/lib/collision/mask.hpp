@@ -0,0 +1,30 @@
+/**
+ * @file mask.hpp
+ * @brief Pixel-perfect collision with 1-bit masks
+ *
+ * A mask has a uint64_t per row, the leftmost texel is the highest bit (masks are up to 64 wide).
+ * Two rows touch when their bits overlap once one is shifted by the distance between them, one AND for a whole row.
+ * The pipes repeat their body row below the cap, so sim_collides (simulation.hpp) picks the rows itself and tests them with maskRow.
+ * The masks of the game are made from the converted textures by collision_masks.py (collision_masks.hpp).
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+struct CollisionMask {
+    uint8_t w;
+    uint8_t h;
+    const uint64_t *rows;
+};
+
+#include "../../collision_masks.hpp"
+
+/**
+ * @param row a row of a mask
+ * @param otherRow a row of another mask, at the same y
+ * @param dx how far right of the other mask the first one is, from -63 to 63
+ */
+inline bool maskRow(uint64_t row, uint64_t otherRow, int dx) {
+    return ((dx >= 0 ? row >> dx : row << -dx) & otherRow) != 0;
+}
@@ -0,0 +1,136 @@
+/**
+ * @file benchmark.hpp
+ * @brief Compares the converted texture files with the raw rgb565 layout
+ *
+ * Build with "make DEFINES='-DBENCHMARK -DASSET_ARENA_SIZE=1048576'", the results are shown before the title screen until EXE is pressed,
+ * the arena has to fit the raw background (textures that don't fit show 0).
+ * Every texture is loaded from its loose file as shipped, then written out again as a raw rgb565 file and loaded from that,
+ * both are drawn a few times. Run it before the asset pack is opened, the loaders read the pack instead otherwise.
+ * The last line is how long the rng takes for BENCHMARK_RANDOMS pipe gaps, one at a time and in bulk.
+ */
+
+#pragma once
+
+#ifdef EMBEDDED_ASSETS
+	#error "the benchmark compares the texture files, build it without EMBEDDED_ASSETS"
+#endif
+
+#include <stdio.h>
+#include "../../calc.hpp"
+#include "../../draw_functions.hpp"
+#include "event_handler.hpp"
+#include "timer.hpp"
+#include "../functions/random.hpp"
+
+#define BENCHMARK_RAW_NAME "benchmark_raw"
+#define BENCHMARK_LOADS 4
+#define BENCHMARK_DRAWS 20
+#define BENCHMARK_RANDOMS 65536
+
+bool benchmark_waiting = false;
+
+void benchmark_continue() {
+	benchmark_waiting = false;
+}
+
+// writes the texture as a raw rgb565 file (big endian like the converter), returns its size or 0
+uint32_t benchmark_write_raw(Texture *tex) {
+	FILE *fd = fopen(PATH_PREFIX BENCHMARK_RAW_NAME, "wb");
+	if (!fd) return 0;
+	uint8_t header[4] = {(uint8_t)(tex->w >> 8), (uint8_t)tex->w, (uint8_t)(tex->h >> 8), (uint8_t)tex->h};
+	fwrite(header, 1, 4, fd);
+	uint16_t *row = (uint16_t*)malloc(tex->w*4);
+	uint8_t *bytes = (uint8_t*)(row + tex->w);
+	for (uint16_t j = 0; row && j < tex->h; j++) {
+		texture_row(tex, j, row);
+		for (uint16_t i = 0; i < tex->w; i++) {
+			bytes[2*i] = row[i] >> 8;
+			bytes[2*i + 1] = row[i] & 0xFF;
+		}
+		fwrite(bytes, 2, tex->w, fd);
+	}
+	free(row);
+	fclose(fd);
+	return 4 + tex->w*tex->h*2;
+}
+
+// milliseconds for loading a texture file BENCHMARK_LOADS times, the size of the file is stored in bytes
+uint32_t benchmark_load(const char *name, uint32_t *bytes) {
+	uint32_t start = timer_ms();
+	for (int k = 0; k < BENCHMARK_LOADS; k++) {
+		ArenaMark mark = arena_mark(&assetArena);
+		Texture *tex = load_texture(name);
+		if (!tex) return 0;
+		TextureFileInfo info;
+		texture_file_info(tex->data, &info);
+		*bytes = info.size;
+		arena_release(&assetArena, mark);
+		txLoaded--;
+	}
+	return timer_elapsed(start);
+}
+
+// milliseconds for drawing a texture BENCHMARK_DRAWS times
+uint32_t benchmark_draw(Texture *tex) {
+	uint32_t start = timer_ms();
+	for (int k = 0; k < BENCHMARK_DRAWS; k++) DRAW_TEXTURE(tex, 0, 0);
+	return timer_elapsed(start);
+}
+
+// the textures are loaded into a scope of the arena that's released at the end
+void benchmark_texture(const char *name) {
+	char line[64];
+	ArenaMark mark = arena_mark(&assetArena);
+	Texture *tex = load_texture(name);
+	if (!tex) return;
+	uint32_t shippedBytes = 0, rawBytes = 0;
+	uint32_t shippedLoad = benchmark_load(name, &shippedBytes);
+	uint32_t shippedDraw = benchmark_draw(tex);
+	benchmark_write_raw(tex);
+	arena_release(&assetArena, mark);
+	txLoaded--;
+	uint32_t rawLoad = benchmark_load(BENCHMARK_RAW_NAME, &rawBytes);
+	Texture *raw = load_texture(BENCHMARK_RAW_NAME);
+	uint32_t rawDraw = raw ? benchmark_draw(raw) : 0;
+	if (raw) txLoaded--;
+	arena_release(&assetArena, mark);
+	remove(PATH_PREFIX BENCHMARK_RAW_NAME);
+	// bytes of the file, then milliseconds per load and per draw
+	snprintf(line, sizeof(line), "%-10s %6u/%6u %4u/%4u %4u/%4u", name, (unsigned)shippedBytes, (unsigned)rawBytes,
+		(unsigned)(shippedLoad / BENCHMARK_LOADS), (unsigned)(rawLoad / BENCHMARK_LOADS), (unsigned)(shippedDraw / BENCHMARK_DRAWS), (unsigned)(rawDraw / BENCHMARK_DRAWS));
+	println(line);
+}
+
+// milliseconds for BENCHMARK_RANDOMS numbers from Generate and from Fill
+void benchmark_rng() {
+	char line[64];
+	static uint16_t buffer[256];
+	RandomGenerator rng;
+	rng.SetSeed(1337);
+	uint32_t sum = 0;
+	uint32_t start = timer_ms();
+	for (uint32_t k = 0; k < BENCHMARK_RANDOMS; k++) sum += rng.Generate(200);
+	uint32_t generate = timer_elapsed(start);
+	start = timer_ms();
+	for (uint32_t k = 0; k < BENCHMARK_RANDOMS; k += 256) {
+		rng.Fill(buffer, 256, 200);
+		sum += buffer[255];
+	}
+	uint32_t fill = timer_elapsed(start);
+	snprintf(line, sizeof(line), "rng %6u gaps %4u ms one by one %4u ms filled (%u)", (unsigned)BENCHMARK_RANDOMS, (unsigned)generate, (unsigned)fill, (unsigned)(sum & 1));
+	println(line);
+}
+
+void benchmark_textures() {
+	fillScreen(0);
+	println("texture     bytes      load ms    draw ms  (shipped/raw)");
+	const char *names[] = {"background", "pipe0", "pipe1", "flappy0", "gameover"};
+	for (const char *name : names) benchmark_texture(name);
+	benchmark_rng();
+	println("EXE to continue");
+	refreshDirty();
+	benchmark_waiting = true;
+	addListener(KEY_EXE, benchmark_continue);
+	while (benchmark_waiting) checkEvents();
+	removeListener(KEY_EXE);
+}
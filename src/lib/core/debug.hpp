@@ -6,6 +6,9 @@
  * @date 2021-12-29
  *
  * It can be useful to track memory usage, framerate and other information.
+ * Memory is what the asset arena has handed out, the biggest assets are listed by the label they were loaded with.
+ * The load line shows how many ms after loading began the first frame was shown and the game took input.
+ * The replay line shows the frames and bytes of the game being recorded, or the first frame a replay being watched went differently.
  * @code{cpp}
  * // Add the toggleDebug() function to your main.cpp - can use any key
  * addListener(KEY_BACKSPACE, toggleDebug);
@@ -18,16 +21,36 @@
 #include "../../calc.hpp"
 #include "../../draw_functions.hpp"
 #include "../../fps_functions.hpp"
+#include "../../fill_functions.hpp"
+#include "loader.hpp"
+#include "replay.hpp"
 
 bool DEBUG = false;
 
+#define DEBUG_LINES 9
+
+// prints the count biggest arena labels next to each other on one line
+void debug_arena_labels(int line, int count) {
+    bool shown[ARENA_LABELS] = {};
+    for (int k = 0; k < count; k++) {
+        int best = -1;
+        for (int i = 0; i < assetArena.labelCount; i++) {
+            if (!shown[i] && (best < 0 || assetArena.labels[i].bytes > assetArena.labels[best].bytes)) best = i;
+        }
+        if (best < 0) return;
+        shown[best] = true;
+        Debug_Printf(7 + k*20, line, true, 0, "%-11s%7d", assetArena.labels[best].name, (int)assetArena.labels[best].bytes);
+    }
+}
+
 void debugger(uint32_t frame) {
     if(DEBUG){
-        int i = 0; while (i<(width*12*3)) vram[i++]=0; //clear the top 3 lines
+        rgb565_fill(vram, width*12*DEBUG_LINES, 0); //clear the top lines
+        markDirty(0, 0, width, 12*DEBUG_LINES);
         Debug_Printf(0,0,true,0,"FRAME");
         Debug_Printf(7,0,true,0,"Flappy Bird - Ported by Sean McGinty");
         Debug_Printf(0,1,true,0,"%05d", (int)frame);
-        Debug_Printf(7,1,true,0,"Mem %8d", (int)memUsed);
+        Debug_Printf(7,1,true,0,"Mem %8d", (int)assetArena.used);
         Debug_Printf(20,1,true,0,"Fonts %01d", (int)fLoaded);
         Debug_Printf(28,1,true,0,"Textures %02d", (int)txLoaded);
         Debug_Printf(46,1,true,0,"V 1.0.0");
@@ -36,6 +59,30 @@ void debugger(uint32_t frame) {
         Debug_Printf(7,2,true,0,"Listeners %02d", (int)(listener_count+listener_count2));
         Debug_Printf(20,2,true,0,"Key1 %11d", (int)ev_key1);
         Debug_Printf(37,2,true,0,"Key2 %11d", (int)ev_key2);
+        // 4th line for what the last frame redrew
+        Debug_Printf(0,3,true,0,"DIRTY");
+        Debug_Printf(7,3,true,0,"Pixels %6d", (int)dirtyStatPixels);
+        Debug_Printf(22,3,true,0,"Rects %1d", (int)dirtyStatRects);
+        // 5th to 7th line for the asset arena, its scopes and the biggest assets
+        Debug_Printf(0,4,true,0,"ARENA");
+        Debug_Printf(7,4,true,0,"Size %7d", (int)assetArena.size);
+        Debug_Printf(20,4,true,0,"High %7d", (int)assetArena.highWater);
+        Debug_Printf(33,4,true,0,"Fail %7d", (int)assetArena.failed);
+        Debug_Printf(0,5,true,0,"SCOPE");
+        Debug_Printf(7,5,true,0,"Session %7d", (int)(levelScope.used - sessionScope.used));
+        Debug_Printf(27,5,true,0,"Level %7d", (int)(assetArena.used - levelScope.used));
+        Debug_Printf(0,6,true,0,"ASSET");
+        debug_arena_labels(6, 2);
+        // 8th line for how long the game took to show something and to start
+        Debug_Printf(0,7,true,0,"LOAD");
+        Debug_Printf(7,7,true,0,"First %6d", (int)assetLoader.firstPixel);
+        Debug_Printf(21,7,true,0,"Ready %6d", (int)assetLoader.interactive);
+        Debug_Printf(35,7,true,0,"Assets %02d/%02d", (int)assetLoader.loaded, (int)assetLoader.count);
+        // 9th line for the replay
+        Debug_Printf(0,8,true,0,"REPLAY");
+        Debug_Printf(7,8,true,0,"Frames %6d", (int)gameReplay.frames);
+        Debug_Printf(22,8,true,0,"Bytes %6d", (int)(gameReplay.eventBytes + gameReplay.frames));
+        Debug_Printf(36,8,true,0,"Diverged %6d", (int)replayPlayer.diverged);
         fps_update();
 		fps_formatted_update();
 		fps_display();
@@ -45,9 +92,5 @@ void debugger(uint32_t frame) {
 void toggleDebug() {
     DEBUG=!DEBUG;
 
-    for (int i = 0; i < 48; i++) {
-        for (int j = 0; j < 320; j++) {
-            setPixel(j, i, color(78, 192, 202));
-        }
-    }
+    fillRect(0, 0, width, 12*DEBUG_LINES, color(78, 192, 202));
 }
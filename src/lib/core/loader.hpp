@@ -0,0 +1,98 @@
+/**
+ * @file loader.hpp
+ * @brief Streams the assets in a little at a time, so the screen keeps updating while they load
+ *
+ * The assets are loaded in the order they're listed, put what's needed first at the front.
+ * Every loader_step reads one chunk of the asset pack or loads one asset, then the caller can draw a frame.
+ * When the asset pack is missing the assets come from the loose files like load_texture and load_font do.
+ * With EMBEDDED_ASSETS there's no pack to read and every step is only a lookup of one built in asset.
+ * An asset that can't be loaded (missing, broken or too big for the arena) is left at 0, loader_missing tells which one.
+ * @code{cpp}
+ * Texture *bg = 0;
+ * Font *font = 0;
+ * LoaderAsset assets[] = {{"background", &bg, 0}, {"5x6", 0, &font}};
+ * loader_begin(&assetLoader, assets, 2);
+ * while (!loader_ready(&assetLoader, 2)) {
+ *     loader_step(&assetLoader);
+ *     drawProgress(loader_progress(&assetLoader, 100));
+ *     refreshDirty();
+ * }
+ * @endcode
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include "../../draw_functions.hpp"
+#include "timer.hpp"
+
+// bytes of the asset pack read per step
+#define LOADER_CHUNK (8*1024)
+
+// either texture or font is set, it's where the loaded asset is stored
+struct LoaderAsset {
+    const char *name; // as given to load_texture or load_font
+    Texture **texture;
+    Font **font;
+};
+
+struct Loader {
+    const LoaderAsset *assets;
+    uint8_t count;
+    uint8_t loaded; // the first loaded assets are resident
+    bool packDone;
+    AssetPackReader pack;
+    uint32_t start; // timer_ms() when loading began
+    uint32_t firstPixel; // ms from the start until the first frame was shown, set by the caller
+    uint32_t interactive; // ms from the start until the game took input, set by the caller
+};
+
+Loader assetLoader = {0, 0, 0, false, {0, 0, 0, 0, {0, 0, 0}}, 0, 0, 0};
+
+void loader_begin(Loader *loader, const LoaderAsset *assets, uint8_t count) {
+    *loader = {assets, count, 0, false, {0, 0, 0, 0, {0, 0, 0}}, timer_ms(), 0, 0};
+#ifdef EMBEDDED_ASSETS
+    // the assets are built into the binary, the pack isn't opened at all
+    loader->packDone = true;
+#else
+    // without an asset pack the assets are read from the loose files
+    loader->packDone = !asset_pack_begin(&loader->pack, PATH_PREFIX ASSET_PACK_NAME, &assetArena);
+#endif
+}
+
+// reads one chunk of the asset pack or loads the next asset, false when there's nothing left to do
+bool loader_step(Loader *loader) {
+    if (!loader->packDone) {
+        loader->packDone = asset_pack_continue(&loader->pack, &assetArena, LOADER_CHUNK);
+        return true;
+    }
+    if (loader->loaded == loader->count) return false;
+    const LoaderAsset *asset = &loader->assets[loader->loaded++];
+    if (asset->texture) *asset->texture = load_texture(asset->name);
+    else *asset->font = load_font(asset->name);
+    return true;
+}
+
+// true when the asset pack and the first count assets are resident
+inline bool loader_ready(const Loader *loader, uint8_t count) {
+    return loader->packDone && loader->loaded >= count;
+}
+
+// the first of the first count assets that was loaded and came out 0, 0 when all of them are there
+const char *loader_missing(const Loader *loader, uint8_t count) {
+    for (uint8_t k = 0; k < count && k < loader->loaded; k++) {
+        const LoaderAsset *asset = &loader->assets[k];
+        if (asset->texture ? !*asset->texture : !*asset->font) return asset->name;
+    }
+    return 0;
+}
+
+inline bool loader_done(const Loader *loader) {
+    return loader_ready(loader, loader->count);
+}
+
+// how much is loaded from 0 to scale, the asset pack counts as much as one asset
+uint32_t loader_progress(const Loader *loader, uint32_t scale) {
+    uint32_t pack = loader->packDone ? scale : loader->pack.read / (loader->pack.size / scale + 1);
+    return (pack + loader->loaded * scale) / (loader->count + 1);
+}
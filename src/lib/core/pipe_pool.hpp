@@ -0,0 +1,69 @@
+/**
+ * @file pipe_pool.hpp
+ * @brief The pipes on screen as a ring buffer of their x, topY and bottomY
+ *
+ * Pipes come in on the right and leave on the left in the same order, so pushing and popping only move a counter.
+ * head and tail count every pipe that ever came in and left, a pipe keeps its serial number (and its slot, serial % PIPE_POOL_SIZE)
+ * for as long as it's on screen, the renderers keep what they know about a pipe in arrays indexed by the same slot.
+ * Build with "make DEFINES=-DPIPE_POOL_SIZE=8" when the pipes come in faster or scroll slower than now and more of them are on screen.
+ * @code{cpp}
+ * for (uint32_t s = pool->head; s != pool->tail; s++) {
+ *     uint8_t k = pipe_slot(s);
+ *     draw(pool->x[k], pool->topY[k], pool->bottomY[k]);
+ * }
+ * @endcode
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+// a power of two, the pipes that can be on screen at once
+#ifndef PIPE_POOL_SIZE
+	#define PIPE_POOL_SIZE 4
+#endif
+
+static_assert(PIPE_POOL_SIZE > 0 && PIPE_POOL_SIZE <= 128 && (PIPE_POOL_SIZE & (PIPE_POOL_SIZE - 1)) == 0, "PIPE_POOL_SIZE has to be a power of two up to 128");
+
+// the top pipe covers the screen down to topY, the bottom one from bottomY down
+struct PipePool {
+	int16_t x[PIPE_POOL_SIZE];
+	int16_t topY[PIPE_POOL_SIZE];
+	int16_t bottomY[PIPE_POOL_SIZE];
+	uint32_t head; // serial of the leftmost pipe
+	uint32_t tail; // serial the next pipe gets, the number of pipes that came in
+};
+
+inline uint8_t pipe_slot(uint32_t serial) {
+	return serial & (PIPE_POOL_SIZE - 1);
+}
+
+inline uint8_t pipe_pool_count(const PipePool *pool) {
+	return pool->tail - pool->head;
+}
+
+// no pipes and the serials start at 0 again
+void pipe_pool_init(PipePool *pool) {
+	pool->head = 0;
+	pool->tail = 0;
+}
+
+// no pipes, the serials carry on
+void pipe_pool_clear(PipePool *pool) {
+	pool->head = pool->tail;
+}
+
+// false when the pool is full, the pipe isn't added then
+bool pipe_pool_push(PipePool *pool, int16_t x, int16_t topY, int16_t bottomY) {
+	if (pipe_pool_count(pool) == PIPE_POOL_SIZE) return false;
+	uint8_t k = pipe_slot(pool->tail++);
+	pool->x[k] = x;
+	pool->topY[k] = topY;
+	pool->bottomY[k] = bottomY;
+	return true;
+}
+
+// drops the leftmost pipe
+void pipe_pool_pop(PipePool *pool) {
+	if (pool->head != pool->tail) pool->head++;
+}
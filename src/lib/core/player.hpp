@@ -4,100 +4,48 @@
  * @brief Player class for the engine
  * @version 1.0
  * @date 2022-01-14
+ *
+ * Draws the bird of a GameState, the bird itself moves in sim_step (see simulation.hpp).
  */
 
 #pragma once
 
 #include "../../draw_functions.hpp"
-
-// Load bg
-uint16_t *bg;
-
-uint32_t frame = 0;
-
-bool game_over = false;
+#include "simulation.hpp"
 
 class Player {
     public:
-        int16_t x = width / 2 - 17; // - 17 to center the player
-        int16_t y = height / 2 - 12; // - 12 to center the player
-        int8_t velocity = 1;
-        int8_t jumpPower = 6;
-        int16_t txWidth = 34;
-        int16_t txHeight = 24;
-        uint16_t *textures[3];
-        uint16_t *bg;
-        int8_t animationFrame = 0;
+        // where the bird was drawn last, erase restores the background there
+        int16_t drawnX = 0;
+        int16_t drawnY = 0;
+        bool drawn = false;
+        Texture *textures[3];
+        Texture *bg;
         void init();
-        void moveJump();
-        void removeOldFrame();
-        void animate();
-        void loadTextures();
-        void line(int16_t x1, int16_t y1, int16_t w, int16_t h);
+        void erase();
+        void render(const GameState *game);
 };
 
+// draws the whole background, the bird shows up at the next render
 void Player::init() {
 	DRAW_TEXTURE(this->bg, 0, 0);
-    this->x = width / 2 - 17;
-    this->y = height / 2 - 12;
-    this->velocity = 1;
-    this->animationFrame = 0;
+    this->drawn = false;
 }
 
-void Player::moveJump() {
-    if (this->velocity > -this->jumpPower) {
-        this->velocity = -this->jumpPower;
+// restores the background where the bird was drawn, call it before the pipes are drawn (see Pipes::invalidate in main.cpp)
+// so pipe pixels under the old bird are drawn again on top of the background and not overwritten by it
+void Player::erase() {
+    if (this->drawn) {
+        restore_rect(this->bg, this->drawnX, this->drawnY, birdWidth, birdHeight);
     }
+    this->drawn = false;
 }
 
-void Player::line(int16_t x1, int16_t y1, int16_t w, int16_t h) {
-    for (int16_t j = y1; j < y1 + h; j++) {
-		for (int16_t i = x1; i < x1+w; i++) {
-            setPixel(i, j, this->bg[2 + j*320 + i]);
-		}
-	}
-}
-
-void Player::animate() {
-    // overwrite buffer for new frame
-	for (int16_t j = this->y; j < this->y + this->txHeight; j++) {
-		for (int16_t i = this->x; i < this->x+this->txWidth; i++) {
-            setPixel(i, j, this->bg[2 + j*320 + i]);
-		}
-	}
-
-    // calculations
-    this->y += this->velocity;
-    if (frame % 3 == 0) {
-        this->velocity++;
-    }
-
-    if (this->y > height) {
-        game_over = true;
-    }
-
-    this->animationFrame++;
-    frame++;
-    if (this->animationFrame > 3) {
-        this->animationFrame = 0;
-    }
-    if (this->animationFrame == 1 || this->animationFrame == 3) {
-        DRAW_TEXTURE(this->textures[1], this->x, this->y);
-    } else {
-        DRAW_TEXTURE(this->textures[this->animationFrame], this->x, this->y);
-    }
-}
-
-void Player::loadTextures() {
-    char hexChars[] = {
-        '0', '1', '2', '3', '4', '5', '6', '7',
-        '8', '9', 'A', 'B', 'C', 'D', 'E', 'F',
-    };
-    char path[32] = "flappy";
-    for (int i=0; i<3; i++) {
-        path[6] = hexChars[i];
-        this->textures[i] = load_texture(path);
-    }
-    LOAD_TEXTURE_PTR("background", bgTx);
-    this->bg = bgTx;
+// draws the bird over whatever is on screen, erase it first
+void Player::render(const GameState *game) {
+    // the frame the collision masks were tested with
+    draw_texture_fixed<birdWidth, birdHeight>(this->textures[sim_bird_frame(game)], game->birdX, game->birdY);
+    this->drawnX = game->birdX;
+    this->drawnY = game->birdY;
+    this->drawn = true;
 }
@@ -0,0 +1,283 @@
+/**
+ * @file replay.hpp
+ * @brief Records the input of a game with its seed and plays it back exactly
+ *
+ * sim_step only depends on the state it starts from and the input of each frame, so a game is its seed (GameState::seed)
+ * and the frames where keys were pressed. The recording keeps those as deltas, the frames without input cost nothing:
+ * one varint per frame with input, (frames since the last one << 1) | 1 when a mask byte follows, 0 when the input is only INPUT_JUMP.
+ * Every frame also stores one byte of a checksum of the state after the step, playback compares them and remembers
+ * the first frame that came out differently (a change to the simulation, the rng or the compiler that changes the game).
+ *
+ * The events grow from the front of the buffer and the checksums from the back, the recording stops at the last frame that fit.
+ * Saved files are big endian: "FBRP", version, 0, width, height, 2 bytes of 0, seed, frames, event bytes and the full checksum
+ * of the last state, then the events, then a checksum byte per frame.
+ * @code{cpp}
+ * replay_record_begin(&gameReplay, &game);
+ * sim_step(&game, input);
+ * replay_record(&gameReplay, input, &game);
+ *
+ * replay_play_begin(&replayPlayer, &gameReplay, &game); // game starts over from the seed
+ * while (!replay_done(&replayPlayer)) {
+ *     sim_step(&game, replay_input(&replayPlayer));
+ *     replay_check(&replayPlayer, &game);
+ * }
+ * @endcode
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+#include "simulation.hpp"
+
+#define REPLAY_VERSION 2
+#define REPLAY_HEADER_SIZE 28
+
+// bytes of the buffer main.cpp records into, a frame takes a byte and a jump another one or two
+#ifndef REPLAY_SIZE
+	#define REPLAY_SIZE 32768
+#endif
+
+struct Replay {
+	uint8_t *data;
+	uint32_t capacity;
+	uint32_t seed;
+	int16_t width;
+	int16_t height;
+	uint32_t frames;
+	uint32_t eventBytes; // at the front of data
+	uint32_t lastEventFrame;
+	uint32_t checksum; // of the state after the last frame
+	bool full; // frames after the last one didn't fit
+};
+
+struct ReplayPlayer {
+	const Replay *replay;
+	uint32_t frame; // frames played
+	uint32_t eventPos;
+	uint32_t eventFrame; // frame of the next event, 0 when there is none
+	uint8_t eventInput;
+	uint32_t diverged; // the first frame whose state differs from the recording, 0 while they match
+};
+
+// the one being recorded or the last one played, see main.cpp
+Replay gameReplay;
+ReplayPlayer replayPlayer;
+
+// 32-bit FNV-1a over everything sim_step reads, the pipe serials are only counted for the renderers
+inline uint32_t replay_hash(uint32_t h, uint32_t v, uint8_t bytes) {
+	for (uint8_t b = 0; b < bytes; b++) h = (h ^ ((v >> (8*b)) & 0xFF)) * 0x01000193;
+	return h;
+}
+
+uint32_t replay_checksum(const GameState *game) {
+	uint32_t h = 0x811C9DC5;
+	h = replay_hash(h, game->frame, 4);
+	h = replay_hash(h, game->birdFrame, 4);
+	h = replay_hash(h, (uint16_t)game->birdX, 2);
+	h = replay_hash(h, (uint16_t)game->birdY, 2);
+	h = replay_hash(h, (uint8_t)game->velocity, 1);
+	h = replay_hash(h, game->animationFrame, 1);
+	const PipePool *pool = &game->pipes;
+	h = replay_hash(h, pipe_pool_count(pool), 1);
+	for (uint32_t s = pool->head; s != pool->tail; s++) {
+		uint8_t k = pipe_slot(s);
+		h = replay_hash(h, (uint16_t)pool->x[k], 2);
+		h = replay_hash(h, (uint16_t)pool->topY[k], 2);
+		h = replay_hash(h, (uint16_t)pool->bottomY[k], 2);
+	}
+	h = replay_hash(h, game->score, 2);
+	h = replay_hash(h, game->over, 1);
+	// the gaps still to come follow from the rng state they were drawn at
+	h = replay_hash(h, game->gapNext, 1);
+	return replay_hash(h, game->rng.m_state, 4);
+}
+
+// the byte kept for every frame
+inline uint8_t replay_checksum_byte(uint32_t checksum) {
+	return checksum ^ (checksum >> 8) ^ (checksum >> 16) ^ (checksum >> 24);
+}
+
+void replay_init(Replay *replay, uint8_t *buffer, uint32_t capacity) {
+	*replay = {buffer, capacity, 0, 0, 0, 0, 0, 0, 0, false};
+}
+
+// call right after sim_init or sim_restart, before the first step of the game
+void replay_record_begin(Replay *replay, const GameState *game) {
+	replay->seed = game->seed;
+	replay->width = game->width;
+	replay->height = game->height;
+	replay->frames = 0;
+	replay->eventBytes = 0;
+	replay->lastEventFrame = 0;
+	replay->checksum = replay_checksum(game);
+	replay->full = false;
+}
+
+// bytes of the varint for v
+inline uint8_t replay_varint_size(uint32_t v) {
+	uint8_t n = 1;
+	while (v >= 0x80) {
+		v >>= 7;
+		n++;
+	}
+	return n;
+}
+
+// call after every step with the input the step was given
+void replay_record(Replay *replay, uint8_t input, const GameState *game) {
+	if (replay->full) return;
+	uint32_t frame = replay->frames + 1;
+	uint32_t value = input ? ((frame - replay->lastEventFrame) << 1) | (input != INPUT_JUMP) : 0;
+	uint32_t bytes = input ? replay_varint_size(value) + (input != INPUT_JUMP) : 0;
+	if (replay->eventBytes + bytes + frame > replay->capacity) {
+		replay->full = true;
+		return;
+	}
+	if (input) {
+		while (value >= 0x80) {
+			replay->data[replay->eventBytes++] = (value & 0x7F) | 0x80;
+			value >>= 7;
+		}
+		replay->data[replay->eventBytes++] = value;
+		if (input != INPUT_JUMP) replay->data[replay->eventBytes++] = input;
+		replay->lastEventFrame = frame;
+	}
+	replay->checksum = replay_checksum(game);
+	replay->data[replay->capacity - frame] = replay_checksum_byte(replay->checksum);
+	replay->frames = frame;
+}
+
+// the checksum byte of a frame, from 1
+inline uint8_t replay_frame_checksum(const Replay *replay, uint32_t frame) {
+	return replay->data[replay->capacity - frame];
+}
+
+inline void replay_put32(uint8_t *p, uint32_t v) {
+	p[0] = v >> 24;
+	p[1] = v >> 16;
+	p[2] = v >> 8;
+	p[3] = v;
+}
+
+inline uint32_t replay_get32(const uint8_t *p) {
+	return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+bool replay_save(const Replay *replay, const char *path) {
+	FILE *fd = fopen(path, "wb");
+	if (!fd) return false;
+	uint8_t header[REPLAY_HEADER_SIZE] = {'F', 'B', 'R', 'P', REPLAY_VERSION, 0,
+		(uint8_t)((uint16_t)replay->width >> 8), (uint8_t)replay->width, (uint8_t)((uint16_t)replay->height >> 8), (uint8_t)replay->height};
+	replay_put32(header + 12, replay->seed);
+	replay_put32(header + 16, replay->frames);
+	replay_put32(header + 20, replay->eventBytes);
+	replay_put32(header + 24, replay->checksum);
+	bool ok = fwrite(header, 1, REPLAY_HEADER_SIZE, fd) == REPLAY_HEADER_SIZE;
+	ok = ok && fwrite(replay->data, 1, replay->eventBytes, fd) == replay->eventBytes;
+	// the checksums are kept last frame first in the buffer
+	uint8_t chunk[64];
+	for (uint32_t frame = 1; ok && frame <= replay->frames; frame += sizeof(chunk)) {
+		uint32_t n = replay->frames - frame + 1 < sizeof(chunk) ? replay->frames - frame + 1 : sizeof(chunk);
+		for (uint32_t k = 0; k < n; k++) chunk[k] = replay_frame_checksum(replay, frame + k);
+		ok = fwrite(chunk, 1, n, fd) == n;
+	}
+	fclose(fd);
+	return ok;
+}
+
+// reads a saved replay into the buffer replay_init gave it, false if the file isn't one or doesn't fit
+bool replay_load(Replay *replay, const char *path) {
+	FILE *fd = fopen(path, "rb");
+	if (!fd) return false;
+	uint8_t header[REPLAY_HEADER_SIZE];
+	bool ok = fread(header, 1, REPLAY_HEADER_SIZE, fd) == REPLAY_HEADER_SIZE && header[0] == 'F' && header[1] == 'B' && header[2] == 'R' && header[3] == 'P' && header[4] == REPLAY_VERSION;
+	uint32_t frames = ok ? replay_get32(header + 16) : 0;
+	uint32_t eventBytes = ok ? replay_get32(header + 20) : 0;
+	ok = ok && frames <= replay->capacity && eventBytes <= replay->capacity - frames;
+	ok = ok && fread(replay->data, 1, eventBytes, fd) == eventBytes;
+	for (uint32_t frame = 1; ok && frame <= frames; frame++) {
+		int c = fgetc(fd);
+		ok = c != EOF;
+		replay->data[replay->capacity - frame] = c;
+	}
+	fclose(fd);
+	if (!ok) {
+		// what was read over the last recording isn't one
+		replay->frames = 0;
+		replay->eventBytes = 0;
+		return false;
+	}
+	replay->width = (header[6] << 8) | header[7];
+	replay->height = (header[8] << 8) | header[9];
+	replay->seed = replay_get32(header + 12);
+	replay->frames = frames;
+	replay->eventBytes = eventBytes;
+	replay->lastEventFrame = 0;
+	replay->checksum = replay_get32(header + 24);
+	replay->full = false;
+	return true;
+}
+
+// reads the next event, eventFrame is 0 once there are none left
+void replay_next_event(ReplayPlayer *player) {
+	const Replay *replay = player->replay;
+	uint32_t value = 0;
+	uint8_t shift = 0;
+	while (player->eventPos < replay->eventBytes) {
+		uint8_t byte = replay->data[player->eventPos++];
+		value |= (uint32_t)(byte & 0x7F) << shift;
+		shift += 7;
+		if (!(byte & 0x80)) break;
+	}
+	if (!value) {
+		player->eventFrame = 0;
+		return;
+	}
+	player->eventFrame += value >> 1;
+	player->eventInput = INPUT_JUMP;
+	if ((value & 1) && player->eventPos < replay->eventBytes) player->eventInput = replay->data[player->eventPos++];
+}
+
+// starts the game over from the replay's seed, on a screen of the replay's size
+void replay_play_begin(ReplayPlayer *player, const Replay *replay, GameState *game) {
+	*player = {replay, 0, 0, 0, 0, 0};
+	replay_next_event(player);
+	sim_init_state(game, replay->seed, replay->width, replay->height);
+}
+
+inline bool replay_done(const ReplayPlayer *player) {
+	return player->frame >= player->replay->frames;
+}
+
+// the input of the next frame
+uint8_t replay_input(ReplayPlayer *player) {
+	player->frame++;
+	if (player->frame != player->eventFrame) return 0;
+	uint8_t input = player->eventInput;
+	replay_next_event(player);
+	return input;
+}
+
+// call after the step, false from the first frame that differs from the recording on
+bool replay_check(ReplayPlayer *player, const GameState *game) {
+	if (!player->diverged) {
+		uint32_t checksum = replay_checksum(game);
+		bool last = player->frame == player->replay->frames;
+		if (replay_checksum_byte(checksum) != replay_frame_checksum(player->replay, player->frame) || (last && checksum != player->replay->checksum)) {
+			player->diverged = player->frame;
+		}
+	}
+	return !player->diverged;
+}
+
+// plays the whole replay without drawing anything, returns the first frame that differs from the recording, 0 if none does
+uint32_t replay_fast_forward(const Replay *replay, GameState *game) {
+	ReplayPlayer player;
+	replay_play_begin(&player, replay, game);
+	while (!replay_done(&player)) {
+		sim_step(game, replay_input(&player));
+		replay_check(&player, game);
+	}
+	return player.diverged;
+}
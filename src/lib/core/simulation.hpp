@@ -0,0 +1,180 @@
+/**
+ * @file simulation.hpp
+ * @brief The game itself without any drawing: the pipes, the bird and the score
+ *
+ * sim_step advances the game by one frame from the keys that were pressed in it, the renderers in main.cpp only read the state.
+ * Nothing here includes calc.hpp, SDL or the SDK, so it builds on any host ("make simulate", see tools/simulate.cpp)
+ * and runs as fast as the cpu can step it.
+ * @code{cpp}
+ * GameState game;
+ * sim_init(&game, 1337, 320, 528);
+ * while (!game.over) {
+ *     sim_step(&game, jumped ? INPUT_JUMP : 0);
+ * }
+ * @endcode
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include "../functions/random.hpp"
+#include "../collision/mask.hpp"
+#include "pipe_pool.hpp"
+
+// the bird frames are 34x24
+const int16_t birdWidth = 34;
+const int16_t birdHeight = 24;
+const int8_t birdJumpPower = 6;
+const int16_t pipeWidth = 52;
+// a pipe comes in every pipeSpawnFrames frames and scrolls a pixel a frame, at most 3 are on screen at once (see PIPE_POOL_SIZE)
+const uint32_t pipeSpawnFrames = 150;
+// the gaps of the next pipes are drawn from the rng this many at a time
+const uint8_t pipeGapsAhead = 16;
+
+static_assert(mask_flappy0.w == birdWidth && mask_flappy0.h == birdHeight, "the bird masks have to be as big as the bird");
+static_assert(mask_pipe0.w == pipeWidth && mask_pipe1.w == pipeWidth, "the pipe masks have to be as wide as the pipes");
+// the bird can only ever be over one pipe, the broad phase of sim_collides depends on it
+static_assert(pipeSpawnFrames >= (uint32_t)(pipeWidth + birdWidth), "pipes closer than that need sim_collides to test more than one");
+
+// bits of the input of one frame
+enum SimInput : uint8_t {
+	INPUT_JUMP = 1,
+};
+
+struct GameState {
+	int16_t width; // of the screen the game is played on
+	int16_t height;
+	uint32_t frame; // frames since the game started
+	uint32_t birdFrame; // frames the bird has fallen for, gravity pulls every 3rd one
+	int16_t birdX;
+	int16_t birdY;
+	int8_t velocity;
+	uint8_t animationFrame; // 0 to 3
+	PipePool pipes; // from left to right, pipes.tail is the number of pipes that came in
+	uint16_t score;
+	bool over;
+	RandomGenerator rng;
+	uint32_t seed; // the rng state the game started from, a replay starts there again
+	// the gaps of the next pipes, topY is 80 + gapTops[k] and bottomY topY + 100 + gapSizes[k]
+	uint16_t gapTops[pipeGapsAhead];
+	uint16_t gapSizes[pipeGapsAhead];
+	uint8_t gapNext; // the next gap to use, pipeGapsAhead when they have to be drawn again
+};
+
+void sim_fill_gaps(GameState *game) {
+	game->rng.Fill(game->gapTops, pipeGapsAhead, 100);
+	game->rng.Fill(game->gapSizes, pipeGapsAhead, 200);
+	game->gapNext = 0;
+}
+
+// a new game on the same random sequence, the rng carries on where the last game stopped
+// the gaps the last game didn't use are dropped, so the game only depends on seed
+void sim_restart(GameState *game) {
+	game->frame = 0;
+	game->birdFrame = 0;
+	game->birdX = game->width / 2 - birdWidth / 2;
+	game->birdY = game->height / 2 - birdHeight / 2;
+	game->velocity = 1;
+	game->animationFrame = 0;
+	pipe_pool_clear(&game->pipes);
+	game->score = 0;
+	game->over = false;
+	game->seed = game->rng.m_state;
+	sim_fill_gaps(game);
+}
+
+// a game that starts with the rng in the state GameState::seed had, what replays start from
+void sim_init_state(GameState *game, uint32_t rngState, int16_t width, int16_t height) {
+	game->width = width;
+	game->height = height;
+	pipe_pool_init(&game->pipes);
+	game->rng.m_state = rngState;
+	sim_restart(game);
+}
+
+void sim_init(GameState *game, uint32_t seed, int16_t width, int16_t height) {
+	RandomGenerator rng;
+	rng.SetSeed(seed);
+	sim_init_state(game, rng.m_state, width, height);
+}
+
+// a pool too small for the pipes on screen skips the pipe, its gap is used all the same so the game stays the same
+void sim_add_pipe(GameState *game) {
+	if (game->gapNext == pipeGapsAhead) sim_fill_gaps(game);
+	int16_t topY = game->gapTops[game->gapNext] + 80;
+	int16_t bottomY = topY + game->gapSizes[game->gapNext] + 100;
+	game->gapNext++;
+	pipe_pool_push(&game->pipes, game->width - 1, topY, bottomY);
+}
+
+// the bird texture of the frame, the wings go up, middle, down, middle
+inline uint8_t sim_bird_frame(const GameState *game) {
+	return game->animationFrame == 3 ? 1 : game->animationFrame;
+}
+
+const CollisionMask *birdMasks[3] = {&mask_flappy0, &mask_flappy1, &mask_flappy2};
+
+// the bird's mask against the mask of the pipe it's over, the top pipe covers the screen down to topY and the bottom one
+// from bottomY to the bottom of the screen, with the cap at the gap and the body row repeated away from it
+bool sim_collides(const GameState *game) {
+	// pipes are ordered from left to right and further apart than the bird and a pipe are wide,
+	// so the first one that isn't behind the bird is the only one that can be over it
+	const PipePool *pool = &game->pipes;
+	uint32_t s = pool->head;
+	while (s != pool->tail && pool->x[pipe_slot(s)] + pipeWidth <= game->birdX) s++;
+	if (s == pool->tail || pool->x[pipe_slot(s)] >= game->birdX + birdWidth) return false;
+	uint8_t k = pipe_slot(s);
+	const CollisionMask *bird = birdMasks[sim_bird_frame(game)];
+	int dx = game->birdX - pool->x[k];
+	int birdY = game->birdY;
+
+	// only the rows of the bird that are inside the box of a pipe are tested
+	int end = pool->topY[k] - birdY < birdHeight ? pool->topY[k] - birdY : birdHeight;
+	for (int j = birdY < 0 ? -birdY : 0; j < end; j++) {
+		int above = pool->topY[k] - 1 - (birdY + j); // rows above the lower edge of the top pipe
+		uint64_t row = above < mask_pipe1.h ? mask_pipe1.rows[mask_pipe1.h - 1 - above] : mask_pipe1_body.rows[0];
+		if (maskRow(bird->rows[j], row, dx)) return true;
+	}
+	end = game->height - birdY < birdHeight ? game->height - birdY : birdHeight;
+	for (int j = pool->bottomY[k] > birdY ? pool->bottomY[k] - birdY : 0; j < end; j++) {
+		int below = birdY + j - pool->bottomY[k]; // rows below the upper edge of the bottom pipe
+		uint64_t row = below < mask_pipe0.h ? mask_pipe0.rows[below] : mask_pipe0_body.rows[0];
+		if (maskRow(bird->rows[j], row, dx)) return true;
+	}
+	return false;
+}
+
+// one frame of the game, input is a mask of SimInput bits, nothing happens once the game is over
+void sim_step(GameState *game, uint8_t input) {
+	if (game->over) return;
+	game->frame++;
+	if ((input & INPUT_JUMP) && game->velocity > -birdJumpPower) {
+		game->velocity = -birdJumpPower;
+	}
+
+	if ((game->frame + 120) % pipeSpawnFrames == 0) {
+		sim_add_pipe(game);
+	}
+	// the score is the number of pipes that have passed
+	if ((game->frame - 100) % pipeSpawnFrames == 0) {
+		game->score = game->frame / pipeSpawnFrames;
+	}
+
+	for (uint32_t s = game->pipes.head; s != game->pipes.tail; s++) {
+		game->pipes.x[pipe_slot(s)] -= 1;
+	}
+	while (pipe_pool_count(&game->pipes) > 0 && game->pipes.x[pipe_slot(game->pipes.head)] < -pipeWidth) {
+		pipe_pool_pop(&game->pipes);
+	}
+
+	game->birdY += game->velocity;
+	if (game->birdFrame % 3 == 0) {
+		game->velocity++;
+	}
+	game->birdFrame++;
+	game->animationFrame = (game->animationFrame + 1) & 3;
+
+	if (game->birdY > game->height || sim_collides(game)) {
+		game->over = true;
+	}
+}
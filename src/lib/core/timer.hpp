@@ -0,0 +1,45 @@
+/**
+ * @file timer.hpp
+ * @brief Millisecond timer for measuring how long things take
+ *
+ * The calculator reads its real time clock (1/128 s steps), the pc uses SDL_GetTicks.
+ * @code{cpp}
+ * uint32_t start = timer_ms();
+ * doSomething();
+ * uint32_t ms = timer_elapsed(start);
+ * @endcode
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include "../../calc.hpp"
+
+#ifndef PC
+// R64CNT counts 1/128 s, RSECCNT holds the seconds in bcd
+volatile uint8_t *const RTC_R64CNT = (volatile uint8_t*)0xA413FEC0;
+volatile uint8_t *const RTC_RSECCNT = (volatile uint8_t*)0xA413FEC2;
+#endif
+
+// the calculator's value wraps every minute, timer_elapsed handles that for anything shorter
+inline uint32_t timer_ms() {
+#ifdef PC
+	return SDL_GetTicks();
+#else
+	uint8_t seconds, ticks;
+	do {
+		seconds = *RTC_RSECCNT;
+		ticks = *RTC_R64CNT & 0x7F;
+	} while (seconds != *RTC_RSECCNT); // read again if the second changed in between
+	uint32_t s = (seconds >> 4) * 10 + (seconds & 15);
+	return (s * 128 + ticks) * 1000 / 128;
+#endif
+}
+
+inline uint32_t timer_elapsed(uint32_t start) {
+#ifdef PC
+	return timer_ms() - start;
+#else
+	return (timer_ms() + 60000 - start) % 60000;
+#endif
+}
@@ -1,22 +1,68 @@
+#pragma once
+
 #include <stdint.h>
 
+// xorshift32 for the state (period 2^32-1, every state but 0) with a multiply on the way out, so the high bits are as good as the low ones
+// Generate(max) maps an output onto 0 to max-1 without favouring any of them (Lemire's multiply and reject),
+// Fill does the same for a whole buffer with the state kept in a register
+// the state is all there is to the generator, a copy of m_state taken at any point plays the same numbers again
 class RandomGenerator {
     public:
         void SetSeed(uint32_t seed);
+        uint32_t Next();
         uint32_t Generate(uint32_t max);
-        uint32_t m_x = 0;
-        uint32_t m_mul = 0;
-        uint32_t m_add = 0;
+        void Fill(uint16_t *out, uint32_t count, uint16_t max);
+        uint32_t m_state = 1;
 };
 
+// seeds next to each other start far apart, and 0 (which xorshift never leaves) can't come out
 void RandomGenerator::SetSeed(uint32_t seed)
 {
-    this->m_x = seed;
-    this->m_mul = 893457621;
-    this->m_add = 198349821;
+    seed = (seed ^ (seed >> 16)) * 0x45D9F3B;
+    seed = (seed ^ (seed >> 16)) * 0x45D9F3B;
+    seed ^= seed >> 16;
+    this->m_state = seed ? seed : 0x9E3779B9;
+}
+
+inline uint32_t random_step(uint32_t x) {
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return x;
+}
+
+inline uint32_t random_output(uint32_t x) {
+    return x * 0x2C1B3C6D;
 }
 
+uint32_t RandomGenerator::Next() {
+    this->m_state = random_step(this->m_state);
+    return random_output(this->m_state);
+}
+
+// the high word of output * max, drawn again in the few cases that would make the low numbers more likely
 uint32_t RandomGenerator::Generate(uint32_t max = 100) {
-    this->m_x = (this->m_mul * this->m_x + this->m_add) % max;
-    return this->m_x;
+    uint64_t m = (uint64_t)this->Next() * max;
+    if ((uint32_t)m < max) {
+        uint32_t threshold = -max % max;
+        while ((uint32_t)m < threshold) {
+            m = (uint64_t)this->Next() * max;
+        }
+    }
+    return m >> 32;
+}
+
+// count numbers from 0 to max-1, the same ones count calls of Generate(max) would have given
+void RandomGenerator::Fill(uint16_t *out, uint32_t count, uint16_t max) {
+    uint32_t x = this->m_state;
+    uint32_t threshold = max ? (uint32_t)-max % max : 0;
+    for (uint32_t i = 0; i < count; i++) {
+        uint64_t m;
+        do {
+            x = random_step(x);
+            m = (uint64_t)random_output(x) * max;
+        } while ((uint32_t)m < threshold);
+        out[i] = m >> 32;
+    }
+    this->m_state = x;
 }
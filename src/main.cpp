@@ -2,11 +2,16 @@
 
 #include "calc.hpp"
 #include "draw_functions.hpp"
+#include "surface.hpp"
 #include "lib/core/event_handler.hpp"
 #include "lib/core/debug.hpp"
 #include "lib/core/player.hpp"
-#include "lib/functions/random.hpp"
-#include "lib/collision/collisions.hpp"
+#include "lib/core/loader.hpp"
+#include "lib/core/simulation.hpp"
+#include "lib/core/replay.hpp"
+#ifdef BENCHMARK
+	#include "lib/core/benchmark.hpp"
+#endif
 
 #ifndef PC
 	APP_NAME("Flappy Bird")
@@ -21,91 +26,152 @@ bool game_running = true;
 // Determines if the user in the restart screen
 bool restart_screen = false;
 
-// RNG pointer
-RandomGenerator* rng;
+// the game being played, main2 steps it and the renderers below draw it
+GameState game;
+
+// SimInput bits of the keys pressed since the last step
+uint8_t frameInput = 0;
+
+// every game is recorded into gameReplay and saved as REPLAY_LAST_NAME when it's over
+// + on the game over screen plays REPLAY_WATCH_NAME when there is one (a replay someone sent), the last game otherwise
+#define REPLAY_LAST_NAME "last.rpl"
+#define REPLAY_WATCH_NAME "watch.rpl"
+uint8_t replayBuffer[REPLAY_SIZE];
+bool watchingReplay = false;
 
 // Player pointer
 Player* player_pointer;
 
+class Pipes;
+// Pipes pointer
+Pipes* pipes_pointer;
+
 const uint16_t pipeHeight = 320;
-const uint16_t pipeWidth = 52;
+const uint16_t pipeCapHeight = 26;
 
-// Pipes
-struct Pipe {
-	int16_t x;
-	int16_t topY;
-	int16_t bottomY;
-};
+const int16_t pipeNotDrawn = -32768;
 
-// Max of 3 on the screen at once
+// draws the pipes of a GameState, the pipes themselves move in sim_step
 class Pipes {
 	public:
-		Pipe pipes[3];
-		int8_t pipeCount = 0;
-		uint16_t *textures[2];
-		void addPipe();
-		void removePipe();
-		void render();
+		// where each pipe currently is on screen, by its slot in the pipe pool, pipeNotDrawn if it hasn't been drawn yet
+		int16_t drawnX[PIPE_POOL_SIZE];
+		uint32_t drawnTail = 0; // the pipes before this serial have had their drawnX reset
+		// index 0 is the bottom pipe with the cap on top, 1 the top pipe with the cap at the bottom
+		Texture *caps[2];
+		Texture *bodyRows[2];
+		TextureScroll *scrolls[2];
+		TextureLine *bodies[2];
+		Texture *bg;
+		bool redraw = false;
+		// a rectangle something else drew over (the background restored under the bird), damageW is 0 when there is none
+		int16_t damageX = 0;
+		int16_t damageY = 0;
+		int16_t damageW = 0;
+		int16_t damageH = 0;
+		bool prepare(Texture *background);
+		void invalidate();
+		void invalidate(int16_t x, int16_t y, int16_t w, int16_t h);
+		void render(const GameState *game);
 		void drawPipe(int16_t x, int16_t y, int8_t index);
-		void checkCollision(int16_t px, int16_t py, int16_t pw, int16_t ph);
+		void scrollPipe(int16_t x, int16_t y, int8_t index);
+		void repaintPipe(int16_t x, int16_t y, int8_t index);
 };
 
-void Pipes::checkCollision(int16_t px, int16_t py, int16_t pw, int16_t ph) {
-	for (int8_t i = 0; i < this->pipeCount; i++) {
-		if (boxBox(px, py, pw, ph, this->pipes[i].x, 0, pipeWidth, this->pipes[i].topY) || boxBox(px, py, pw, ph, this->pipes[i].x, this->pipes[i].bottomY, pipeWidth, height-this->pipes[i].bottomY)) {
-			// game over
-			game_over = true;
-		}
+// the pipe files are only the caps, the body is one row that is repeated for the rest of the pipe
+// call once the caps and body rows are loaded, false when the arena had no room for the scroll tables and body lines
+bool Pipes::prepare(Texture *background) {
+	bool ok = true;
+	for (int i = 0; i < 2; i++) {
+		this->scrolls[i] = texture_build_scroll(this->caps[i]);
+		this->bodies[i] = texture_build_line(this->bodyRows[i], 0);
+		ok = ok && this->scrolls[i] && this->bodies[i];
 	}
+	this->bg = background;
+	return ok;
 }
 
-void Pipes::addPipe() {
-	this->pipes[pipeCount].x = width-1;
-	pipes[pipeCount].topY = rng->Generate(100)+80;
-	pipes[pipeCount].bottomY = pipes[pipeCount].topY + rng->Generate(200)+100;
-	this->pipeCount++;
+// Call when something else drew over the pipes, they get fully redrawn on the next render
+void Pipes::invalidate() {
+	this->redraw = true;
 }
 
-void Pipes::removePipe() {
-	// shift pipes down
-	for (int i = 1; i < pipeCount; i++) {
-		this->pipes[i - 1] = this->pipes[i];
+// Call when something else drew over the pipes inside a rectangle, the pipe rows in it get redrawn on the next render
+// the scroll only writes the pixels that changed since the last frame, so without this whatever was drawn there would stay
+void Pipes::invalidate(int16_t x, int16_t y, int16_t w, int16_t h) {
+	if (w <= 0 || h <= 0) return;
+	if (this->damageW > 0) {
+		int16_t right = x + w > this->damageX + this->damageW ? x + w : this->damageX + this->damageW;
+		int16_t bottom = y + h > this->damageY + this->damageH ? y + h : this->damageY + this->damageH;
+		if (this->damageX < x) x = this->damageX;
+		if (this->damageY < y) y = this->damageY;
+		w = right - x;
+		h = bottom - y;
 	}
-	this->pipeCount--;
+	this->damageX = x;
+	this->damageY = y;
+	this->damageW = w;
+	this->damageH = h;
 }
 
+// y is the top of the pipeHeight tall pipe, the body is only drawn as far as it's on screen
 void Pipes::drawPipe(int16_t x, int16_t y, int8_t index) {
-	for (int16_t j = 0; j < pipeHeight; j++) {
-		for (int16_t i = 0; i < pipeWidth; i++) {
-			if (this->textures[0][2 + j*pipeWidth + i] != TRANSPARENCY_COLOR) {
-		setPixel(x+i, y+j, this->textures[index][2 + j*pipeWidth + i]);
-			}
-		}
-	}
+	int capY = index == 0 ? y : y + pipeHeight - this->caps[index]->h;
+	int bodyY = index == 0 ? y + this->caps[index]->h : y;
+	draw_texture_fixed<pipeWidth, pipeCapHeight>(this->caps[index], x, capY);
+	draw_texture_line(this->bodies[index], x, bodyY, pipeHeight - this->caps[index]->h);
 }
 
-void Pipes::render() {
-	for (int i = 0; i < this->pipeCount; i++) {
-
-		this->drawPipe(this->pipes[i].x, this->pipes[i].topY - pipeHeight, 1);
-		//manual draw outset - some bug idk
-		line(this->pipes[i].x + 50, this->pipes[i].topY - 24, this->pipes[i].x + 50, this->pipes[i].topY - 1, color(84, 56, 71));
-		line(this->pipes[i].x, this->pipes[i].topY - 24, this->pipes[i].x, this->pipes[i].topY - 1, color(84, 56, 71));
-		player_pointer->line(this->pipes[i].x + pipeWidth, this->pipes[i].topY - 24, 1, 24); // clear old pipe line outset
-		player_pointer->line(this->pipes[i].x + (pipeWidth-2), this->pipes[i].topY - pipeHeight, 1, (pipeHeight-24)); // clear old pipe line inset
-
-		this->drawPipe(this->pipes[i].x, this->pipes[i].bottomY, 0);
-		player_pointer->line(this->pipes[i].x + pipeWidth, this->pipes[i].bottomY, 1, 24); // clear old pipe line outset
-		player_pointer->line(this->pipes[i].x + (pipeWidth-2), this->pipes[i].bottomY+24, 1, (pipeHeight-24)); // clear old pipe line inset
-
+// Redraws a pipe that moved one pixel to the left, only touching the columns that changed
+void Pipes::scrollPipe(int16_t x, int16_t y, int8_t index) {
+	int capY = index == 0 ? y : y + pipeHeight - this->caps[index]->h;
+	int bodyY = index == 0 ? y + this->caps[index]->h : y;
+	blit_texture_scroll(this->caps[index], this->scrolls[index], x, capY, this->bg);
+	blit_texture_line_scroll(this->bodies[index], x, bodyY, pipeHeight - this->caps[index]->h, this->bg);
+}
 
-		// Movement
-		this->pipes[i].x -= 1;
+// redraws the rows of a pipe that are inside the damaged rectangle, whole rows of the cap and the body
+void Pipes::repaintPipe(int16_t x, int16_t y, int8_t index) {
+	int capH = this->caps[index]->h;
+	int capY = index == 0 ? y : y + pipeHeight - capH;
+	int bodyY = index == 0 ? y + capH : y;
+	int top = this->damageY;
+	int bottom = this->damageY + this->damageH;
+	int first = top > capY ? top - capY : 0;
+	int last = bottom < capY + capH ? bottom - capY : capH;
+	if (first < last) blit_texture_rows(this->caps[index], x, capY + first, first, last - first);
+	first = top > bodyY ? top : bodyY;
+	last = bottom < bodyY + pipeHeight - capH ? bottom : bodyY + pipeHeight - capH;
+	if (first < last) draw_texture_line(this->bodies[index], x, first, last - first);
+}
 
-		if (this->pipes[i].x < -pipeWidth) {
-			this->removePipe();
+void Pipes::render(const GameState *game) {
+	const PipePool *pool = &game->pipes;
+	// pipes that came in since the last render haven't been drawn, a game started from a replay counts from 0 again
+	if (pool->tail < this->drawnTail) this->drawnTail = pool->head;
+	for (; this->drawnTail != pool->tail; this->drawnTail++) {
+		this->drawnX[pipe_slot(this->drawnTail)] = pipeNotDrawn;
+	}
+	for (uint32_t s = pool->head; s != pool->tail; s++) {
+		uint8_t k = pipe_slot(s);
+		int16_t x = pool->x[k];
+		bool scrolled = this->drawnX[k] == x + 1;
+
+		if (scrolled) {
+			this->scrollPipe(x, pool->topY[k] - pipeHeight, 1);
+			this->scrollPipe(x, pool->bottomY[k], 0);
 		}
+		if (!scrolled || this->redraw) {
+			this->drawPipe(x, pool->topY[k] - pipeHeight, 1);
+			this->drawPipe(x, pool->bottomY[k], 0);
+		} else if (this->damageW > 0 && x < this->damageX + this->damageW && x + pipeWidth > this->damageX) {
+			this->repaintPipe(x, pool->topY[k] - pipeHeight, 1);
+			this->repaintPipe(x, pool->bottomY[k], 0);
+		}
+		this->drawnX[k] = x;
 	}
+	this->redraw = false;
+	this->damageW = 0;
 }
 
 // Ends the game and is called by the event handler
@@ -117,70 +183,187 @@ void endGame() {
 // Restarts the game and is called by the event handler
 void restart() {
 	restart_screen = false;
-	game_over = false;
-	player_pointer->init();
 }
 
-// jump
+// watches a replay instead of restarting, called by the event handler
+void watchReplay() {
+	if (!restart_screen) return;
+	restart_screen = false;
+	watchingReplay = true;
+}
+
+// jump, applied by the next step of the game
 void jump() {
-	player_pointer->moveJump();
+	frameInput |= INPUT_JUMP;
+}
+
+// the debug overlay clears the top of the screen, so pipes have to be redrawn there
+void debugToggle() {
+	toggleDebug();
+	pipes_pointer->invalidate();
+}
+
+// the loading bar on the title screen
+const int16_t progressX = 60;
+const int16_t progressY = 300;
+const int16_t progressWidth = 200;
+const int16_t progressHeight = 10;
+
+void drawProgress(uint32_t done) {
+	fillRect(progressX - 2, progressY - 2, progressWidth + 4, progressHeight + 4, color(84, 56, 71));
+	fillRect(progressX, progressY, progressWidth, progressHeight, color(255, 255, 255));
+	fillRect(progressX, progressY, done, progressHeight, color(252, 160, 72));
+}
+
+// what the game can't do without didn't load, so it says which asset it was and waits for clear
+// it's written with the system font, the missing asset can be one of the fonts
+void showLoadError(const char *name) {
+	fillRect(0, 0, width, height, color(78, 192, 202));
+	refreshDirty();
+	Debug_Printf(1, 2, false, 0, "Couldn't load %s", name);
+	Debug_Printf(1, 3, false, 0, "from " ASSET_PACK_NAME " or the files in");
+	Debug_Printf(1, 4, false, 0, "%s", PATH_PREFIX);
+	Debug_Printf(1, 6, false, 0, "Asset memory %d bytes, %d didn't fit", (int)assetArena.size, (int)assetArena.failed);
+	Debug_Printf(1, 8, false, 0, "Press Clear to exit");
+	LCD_Refresh();
+	while (game_running) {
+		checkEvents();
+	}
+}
+
+// the game over card is drawn into a surface once, it's only blitted after that
+Surface *gameoverCard = 0;
+
+// the score is drawn into its surface whenever it changes, the surface is blitted every frame
+void renderScore(Surface *surface, TextLayout *text) {
+	if (!surface || !text) return;
+	surface_begin(surface, true);
+	DRAW_TEXT(text, 0, 0, color(255, 255, 255));
+	surface_end(surface);
 }
 
 //The acutal main
 void main2() {
 
-	RandomGenerator rngp;
-	rngp.SetSeed(1337);
-	rng = &rngp;
+	// the pipes come from the same seed every time, the rng carries on over restarts
+	sim_init(&game, 1337, width, height);
+	replay_init(&gameReplay, replayBuffer, REPLAY_SIZE);
 
 	Pipes pipes;
-	pipes.textures[0] = load_texture("pipe0");
-	pipes.textures[1] = load_texture("pipe1");
+	pipes_pointer = &pipes;
 
-	// load the textures and fonts
-	LOAD_FONT_PTR("5x6", f_5x6);
-	LOAD_FONT_PTR("7x8", f_7x8);
+	// every asset lives in one block taken from the heap here, the session scope holds what's loaded at startup
+	arena_init(&assetArena, ASSET_ARENA_SIZE);
+	sessionScope = arena_mark(&assetArena);
 
-	// Add event listeners
-	addListener(KEY_BACKSPACE, toggleDebug); // toggle debug mode
-	addListener(KEY_CLEAR, endGame); // end the game
-
-	addListener2(KEY_UP, jump); // jump
-	addListener(KEY_EXE, restart); // restart the game
+#ifdef BENCHMARK
+	// reads the loose texture files, so it has to run before the asset pack is open
+	benchmark_textures();
+#endif
 
 	Player player;
-	player.loadTextures();
-	player.init();
 	player_pointer = &player;
+	Font *f_5x6 = 0;
+	Font *f_7x8 = 0;
+	// Game over screen (192x42 px)
+	Texture *gameover = 0;
+
+	// streamed in this order while the title screen is up, from the asset pack when it's there
+	// the title needs the first two, the game can do without the game over screen but not without the rest
+	// all of them belong to the session, so the title stays up until the last one is in and the level scope starts behind them
+	const LoaderAsset assets[] = {
+		{"5x6", 0, &f_5x6},
+		{"background", &player.bg, 0},
+		{"flappy0", &player.textures[0], 0},
+		{"flappy1", &player.textures[1], 0},
+		{"flappy2", &player.textures[2], 0},
+		{"pipe0", &pipes.caps[0], 0},
+		{"pipe1", &pipes.caps[1], 0},
+		{"pipe0_body", &pipes.bodyRows[0], 0},
+		{"pipe1_body", &pipes.bodyRows[1], 0},
+		{"7x8", 0, &f_7x8},
+		{"gameover", &gameover, 0},
+	};
+	const uint8_t assetCount = sizeof(assets) / sizeof(assets[0]);
+	const uint8_t titleAssets = 2;
+	const uint8_t gameAssets = assetCount - 1;
+	loader_begin(&assetLoader, assets, assetCount);
+
+	// the first frame is only the sky and the empty loading bar, so it's up before anything is read
+	fillRect(0, 0, width, height, color(78, 192, 202));
+	drawProgress(0);
+	refreshDirty();
+	assetLoader.firstPixel = timer_elapsed(assetLoader.start);
 
-	// Load game over screen (192x42 px)
-	LOAD_TEXTURE_PTR("gameover", gameover);
+	// Add event listeners
+	addListener(KEY_BACKSPACE, debugToggle); // toggle debug mode
+	addListener(KEY_CLEAR, endGame); // end the game
 
-	// game starting screen
-	for (int i = 0; i < 64; i+=5) {
-		draw_font_shader(f_5x6, "Flappy Bird", 20, 100, color(252, 160, 72), 0, 0, 4, color(228, 96, 24));
-		LCD_Refresh();
+	addListener2(KEY_UP, jump); // jump
+	addListener(KEY_EXE, restart); // restart the game
+	addListener(KEY_ADD, watchReplay); // watch the last game
+
+	// game starting screen, it stays up until the game has what it needs
+	bool titleShown = false;
+	while (!loader_done(&assetLoader)) {
+		loader_step(&assetLoader);
+		if (!titleShown && loader_ready(&assetLoader, titleAssets)) {
+			titleShown = true;
+			// without them the loading bar stays on the sky, the error is shown once the loop is done
+			if (loader_missing(&assetLoader, titleAssets)) continue;
+			player.init();
+			// 4x scale plus a one pixel shadow, every lit pixel of the font is 32 plots, so it's only drawn once and straight to the screen
+			draw_font_shader<ShaderScale4Shadow>(f_5x6, "Flappy Bird", 20, 100, color(252, 160, 72), 0, 0, color(228, 96, 24));
+		}
+		drawProgress(loader_progress(&assetLoader, progressWidth));
+		refreshDirty();
+	}
+	const char *missing = loader_missing(&assetLoader, gameAssets);
+	if (!missing && !pipes.prepare(player.bg)) missing = "the pipe tables";
+	if (missing) {
+		showLoadError(missing);
+		close_asset_pack();
+		arena_destroy(&assetArena);
+		return;
 	}
+	arena_label(&assetArena, "card");
+	gameoverCard = surface_from_texture(gameover);
 
 	// redraw bg
 	player.init();
 
-	uint32_t frame = 0;
+	uint16_t shownScore = 0;
 	char score[12] = "Score: 0   ";
+	// the level scope holds what one game needs and is released when it restarts, it's taken once with everything else behind it
+	levelScope = arena_mark(&assetArena);
+	arena_label(&assetArena, "score");
+	// the score only changes every 150 frames, so it's laid out and drawn into its surface once per change
+	TextLayout *scoreText = layout_text(f_7x8, score, 0, 1);
+	const uint16_t scoreWidth = (sizeof(score) - 1)*(f_7x8->w + CHAR_SPACING);
+	Surface *scoreSurface = surface_create(scoreWidth, f_7x8->h);
+	renderScore(scoreSurface, scoreText);
+	assetLoader.interactive = timer_elapsed(assetLoader.start);
+	replay_record_begin(&gameReplay, &game);
 
 	while (game_running) {
-		frame++;
 		checkEvents();
 
-		// game events
-		if ((frame+120) % 150 == 0) {
-			pipes.addPipe();
+		// a replay being watched ignores the keys, one that was cut off is over after its last frame
+		uint8_t input = frameInput;
+		if (watchingReplay) input = replay_done(&replayPlayer) ? 0 : replay_input(&replayPlayer);
+		sim_step(&game, input);
+		frameInput = 0;
+		if (watchingReplay) {
+			replay_check(&replayPlayer, &game);
+			if (replay_done(&replayPlayer)) game.over = true;
+		} else {
+			replay_record(&gameReplay, input, &game);
 		}
 
-		if ((frame-100) % 150 == 0) {
-			int16_t scoreInt = frame / 150;
+		if (game.score != shownScore) {
+			int16_t scoreInt = game.score;
+			shownScore = game.score;
 			int8_t xCount = 9;
-			// score is the number of pipes that have passed or frames / 150
 			if (scoreInt > 999) {
 				xCount = 12;
 				score[7] = '0' + (scoreInt / 1000);
@@ -199,46 +382,60 @@ void main2() {
 			} else {
 				score[7] = '0' + scoreInt % 10;
 			}
-			// clear old score
-		    for (int i = 0; i < 8; i++) {
-				for (int j = 49; j < xCount*7; j++) {
-					setPixel(12+j, 12+i, color(78, 192, 202));
-				}
-		}
+			// clear old score, the digits start at the 8th character and every character is 8px wide
+			fillRect(12 + 7*8, 12, (xCount-7)*8, 8, color(78, 192, 202));
+			if (scoreText) relayout_text(scoreText, score);
+			renderScore(scoreSurface, scoreText);
+			pipes.invalidate();
 		}
-		pipes.render();
-
-		player.animate();
-
-		DRAW_FONT(f_7x8, score, 12, 12, color(255, 255, 255), 0);
-
-		pipes.checkCollision(player.x, player.y, player.txWidth, player.txHeight);
-
-		if (game_over) {
-			DRAW_TEXTURE(gameover, 64, 192);
-			LCD_Refresh();
+		// the background goes back under the old bird first, the pipes then repaint what it covered of them
+		if (player.drawn) pipes.invalidate(player.drawnX, player.drawnY, birdWidth, birdHeight);
+		player.erase();
+		pipes.render(&game);
+		player.render(&game);
+
+		if (scoreSurface) DRAW_TEXTURE(&scoreSurface->texture, 12, 12);
+
+		if (game.over) {
+			if (gameoverCard) DRAW_TEXTURE(&gameoverCard->texture, 64, 192);
+			refreshDirty();
+			if (!watchingReplay) replay_save(&gameReplay, PATH_PREFIX REPLAY_LAST_NAME);
+			watchingReplay = false;
 			// load restart screen
 			restart_screen = true;
 			while(restart_screen) {
 				checkEvents();
 			}
-			frame = 0;
-			for (int i = 0; i < pipes.pipeCount; i++) {
-				pipes.removePipe();
+			if (watchingReplay && !replay_load(&gameReplay, PATH_PREFIX REPLAY_WATCH_NAME)) {
+				// no replay was sent, the last game is still in the buffer unless a broken one was read over it
+				watchingReplay = gameReplay.frames > 0;
+			}
+			if (watchingReplay) {
+				replay_play_begin(&replayPlayer, &gameReplay, &game);
+			} else {
+				sim_restart(&game);
+				replay_record_begin(&gameReplay, &game);
 			}
+			frameInput = 0;
+			player.init();
+			shownScore = 0;
 			score[7] = '0';
 			score[8] = ' ';
 			score[9] = ' ';
 			score[10] = ' ';
+			arena_release(&assetArena, levelScope);
+			arena_label(&assetArena, "score");
+			scoreText = layout_text(f_7x8, score, 0, 1);
+			scoreSurface = surface_create(scoreWidth, f_7x8->h);
+			renderScore(scoreSurface, scoreText);
 		}
 
-		debugger(frame);
-		LCD_Refresh();
+		debugger(game.frame);
+		refreshDirty();
 	}
 
-	// free memory
-	free(f_5x6);
-	free(f_7x8);
+	// free memory, everything was allocated from the arena
+	close_asset_pack();
+	arena_destroy(&assetArena);
 	// free(player_pointer);
-	// free(rng);
 }
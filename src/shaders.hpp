@@ -1,11 +1,17 @@
 // shaders.hpp template by InterChan
 
-// this file's function goes with draw_functions.hpp
-// you can add case clauses for custom shaders, and the available variables allow for fancy effects
+// this file's shaders go with draw_functions.hpp
+// every shader is a struct with a static plot() function, and the draw functions are templates instantiated once per shader
+// so the choice of shader is made once per draw call instead of once per pixel
+// you can add structs for custom shaders (and a case in shader_dispatch() if you want to pick them with a runtime shaderID)
+// the available variables allow for fancy effects
 // "x" and "y" coordinates represent where the top-left corner of the texture is
 // "w" and "h" are the width and height of the texture
 // "i" and "j" are the x and y offsets from the top-left corner, for the current pixel to be drawn
 // when using draw_texture_shader() you can include extra information with "shaderArg"
+// shaders with "cutout = true" only skip TRANSPARENCY_COLOR, so textures are drawn with the span blitter instead of plot()
+// and they tell it which texture rows to draw with rowRange()
+// shaders with "solid = true" draw exactly pixel i, j in the given color, so text is drawn as horizontal runs instead of plot()
 
 #pragma once
 
@@ -14,47 +20,100 @@
 
 #define TRANSPARENCY_COLOR 0xF81F // (255, 0, 255) or #FF00FF
 
-void shader(int16_t x, int16_t y, int16_t w, int16_t h, int16_t i, int16_t j, uint16_t color, uint16_t shaderID, int shaderArg) {
-	switch (shaderID) {
-		default: case 0:
-			// no effects
+// 0: no effects
+struct ShaderPlain {
+	static constexpr bool cutout = false;
+	static constexpr bool solid = true;
+	static inline void plot(int16_t x, int16_t y, int16_t w, int16_t h, int16_t i, int16_t j, uint16_t color, int shaderArg) {
+		(void)w; (void)h; (void)shaderArg;
+		setPixel(x + i, y + j, color);
+	}
+};
+
+// 1: cutout (default shader, used by DRAW_TEXTURE)
+struct ShaderCutout {
+	static constexpr bool cutout = true;
+	static constexpr bool solid = true;
+	static inline void plot(int16_t x, int16_t y, int16_t w, int16_t h, int16_t i, int16_t j, uint16_t color, int shaderArg) {
+		(void)w; (void)h; (void)shaderArg;
+		if (color != TRANSPARENCY_COLOR) {
 			setPixel(x + i, y + j, color);
-			break;
-		case 1:
-			// cutout (default shader, used by DRAW_TEXTURE)
-			if (color != TRANSPARENCY_COLOR) {
-				setPixel(x + i, y + j, color);
-			}
-			break;
-		case 2:
-			// frame selection + cutout (for textures containing multiple "frames", useful for rotation, animations and texture variants. see texture_rotator.py)
-			// (this uses the texture width as the height of one frame, so make sure the frames are square)
-			if (j / w == shaderArg) {
-				shader(x, y - shaderArg * w, w, h, i, j, color, 1, 0);
-			}
-			break;
-		case 3:
-			// scaling of 4 + sine wavy effect, the amplitude is fixed but shaderArg alters the period
-			for (int b = 0; b < 4; b++) {
-				for (int a = 0; a < 4; a++) {
-					setPixel(x + i * 4 + a + SIN((j*4+b) * shaderArg / 2, 60), y + j * 4 + b, color);
-				}
-			}
-			break;
-		case 4:
-			// scaling of 4 + drop shadow
-			for (int b = 0; b < 4; b++) {
-				for (int a = 0; a < 4; a++) {
-					shader(x, y, w, h, i * 4 + a, j * 4 + b, color, 5, shaderArg);
-				}
+		}
+	}
+	static inline void rowRange(uint16_t w, uint16_t h, int shaderArg, int *first, int *count) {
+		(void)w; (void)shaderArg;
+		*first = 0;
+		*count = h;
+	}
+};
+
+// 2: frame selection + cutout (for textures containing multiple "frames", useful for rotation, animations and texture variants. see texture_rotator.py)
+// (this uses the texture width as the height of one frame, so make sure the frames are square)
+struct ShaderFrame {
+	static constexpr bool cutout = true;
+	static constexpr bool solid = false;
+	static inline void plot(int16_t x, int16_t y, int16_t w, int16_t h, int16_t i, int16_t j, uint16_t color, int shaderArg) {
+		if (j / w == shaderArg) {
+			ShaderCutout::plot(x, y - shaderArg * w, w, h, i, j, color, 0);
+		}
+	}
+	static inline void rowRange(uint16_t w, uint16_t h, int shaderArg, int *first, int *count) {
+		*first = shaderArg * w;
+		*count = *first + w > h ? h - *first : w;
+		if (shaderArg < 0) *count = 0;
+	}
+};
+
+// 3: scaling of 4 + sine wavy effect, the amplitude is fixed but shaderArg alters the period
+struct ShaderWave4 {
+	static constexpr bool cutout = false;
+	static constexpr bool solid = false;
+	static inline void plot(int16_t x, int16_t y, int16_t w, int16_t h, int16_t i, int16_t j, uint16_t color, int shaderArg) {
+		(void)w; (void)h;
+		for (int b = 0; b < 4; b++) {
+			for (int a = 0; a < 4; a++) {
+				setPixel(x + i * 4 + a + SIN((j*4+b) * shaderArg / 2, 60), y + j * 4 + b, color);
 			}
-			break;
-		case 5:
-			// drop shadow for each pixel with color shaderArg
-			if (color != TRANSPARENCY_COLOR) {
-				setPixel(x + i, y + j, color);
-				setPixel(x + i + 1, y + j + 1, (uint16_t)shaderArg);
+		}
+	}
+};
+
+// 5: drop shadow for each pixel with color shaderArg
+struct ShaderShadow {
+	static constexpr bool cutout = false;
+	static constexpr bool solid = false;
+	static inline void plot(int16_t x, int16_t y, int16_t w, int16_t h, int16_t i, int16_t j, uint16_t color, int shaderArg) {
+		(void)w; (void)h;
+		if (color != TRANSPARENCY_COLOR) {
+			setPixel(x + i, y + j, color);
+			setPixel(x + i + 1, y + j + 1, (uint16_t)shaderArg);
+		}
+	}
+};
+
+// 4: scaling of 4 + drop shadow
+struct ShaderScale4Shadow {
+	static constexpr bool cutout = false;
+	static constexpr bool solid = false;
+	static inline void plot(int16_t x, int16_t y, int16_t w, int16_t h, int16_t i, int16_t j, uint16_t color, int shaderArg) {
+		for (int b = 0; b < 4; b++) {
+			for (int a = 0; a < 4; a++) {
+				ShaderShadow::plot(x, y, w, h, i * 4 + a, j * 4 + b, color, shaderArg);
 			}
-			break;
+		}
+	}
+};
+
+// calls draw.template operator()<Shader>() for the shader with the given runtime shaderID
+// this is how the old shaderID based entry points pick their instantiation, once per call
+template <typename Draw>
+inline void shader_dispatch(uint16_t shaderID, Draw draw) {
+	switch (shaderID) {
+		default: case 0: draw.template operator()<ShaderPlain>(); break;
+		case 1: draw.template operator()<ShaderCutout>(); break;
+		case 2: draw.template operator()<ShaderFrame>(); break;
+		case 3: draw.template operator()<ShaderWave4>(); break;
+		case 4: draw.template operator()<ShaderScale4Shadow>(); break;
+		case 5: draw.template operator()<ShaderShadow>(); break;
 	}
 }
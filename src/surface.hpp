@@ -0,0 +1,111 @@
+// surface.hpp
+
+// Offscreen rgb565 surfaces the draw functions can draw into instead of vram
+// surface_begin points vram, width and height at the surface until surface_end, so every draw function and shader works on it unchanged,
+// the dirty rectangles of the screen are put back by surface_end, drawing into a surface never makes the screen upload anything
+// surface_end finds the opaque runs of the surface, after that surface->texture is drawn like any other texture (DRAW_TEXTURE)
+// Compositions that are expensive to draw and don't change (scaled text with a shadow, a whole card) are drawn once and only blitted afterwards
+// @code{cpp}
+// Surface *title = surface_create(265, 25);
+// surface_begin(title);
+// draw_font_shader<ShaderScale4Shadow>(font, "Flappy Bird", 0, 0, color(252, 160, 72), 0, 0, color(228, 96, 24));
+// surface_end(title);
+// DRAW_TEXTURE(&title->texture, 20, 100);
+// @endcode
+
+#pragma once
+
+#include <stdint.h>
+#include "draw_functions.hpp"
+
+struct Surface {
+	uint16_t w;
+	uint16_t h;
+	uint32_t stride; // pixels from one row to the next, always w for the surfaces the draw functions can target
+	uint16_t *pixels;
+	uint32_t *rowSpans; // the opaque runs, like a texture's (h+1 entries)
+	TextureSpan *spans;
+	uint32_t spanCapacity;
+	Texture texture; // rgb565 view of the pixels and the runs
+};
+
+// what surface_begin took away from the screen
+struct SurfaceTarget {
+	uint16_t *vram;
+	int width;
+	int height;
+	uint8_t dirtyRectCount;
+	DirtyRect dirtyRects[maxDirtyRects];
+	DirtyRect dirtyPixelBox;
+};
+
+SurfaceTarget surfaceScreen;
+
+// a transparent surface from the arena, 0 when it doesn't fit
+Surface *surface_create(uint16_t w, uint16_t h) {
+	Surface *surface = (Surface*)arena_alloc(&assetArena, sizeof(Surface) + (h+1)*sizeof(uint32_t) + w*h*2);
+	if (!surface) return 0;
+	surface->w = w;
+	surface->h = h;
+	surface->stride = w;
+	surface->rowSpans = (uint32_t*)(surface + 1);
+	surface->pixels = (uint16_t*)(surface->rowSpans + h + 1);
+	surface->spans = 0;
+	surface->spanCapacity = 0;
+	rgb565_fill(surface->pixels, w*h, TRANSPARENCY_COLOR);
+	memset(surface->rowSpans, 0, (h+1)*sizeof(uint32_t));
+	surface->texture = {w, h, TEXTURE_RGB565, surface->stride*2, 0, (const uint8_t*)surface->pixels, 0, 0, 0, 0, surface->rowSpans, 0, 0};
+	return surface;
+}
+
+// everything drawn until surface_end goes into the surface, with its top-left corner at 0, 0
+// surfaces don't nest, clear makes the whole surface transparent again first
+void surface_begin(Surface *surface, bool clear = false) {
+	surfaceScreen.vram = vram;
+	surfaceScreen.width = width;
+	surfaceScreen.height = height;
+	surfaceScreen.dirtyRectCount = dirtyRectCount;
+	memcpy(surfaceScreen.dirtyRects, dirtyRects, sizeof(dirtyRects));
+	surfaceScreen.dirtyPixelBox = dirtyPixelBox;
+	vram = surface->pixels;
+	width = surface->w;
+	height = surface->h;
+	if (clear) rgb565_fill(surface->pixels, surface->w*surface->h, TRANSPARENCY_COLOR);
+}
+
+// draws to the screen again and finds the opaque runs of the surface
+// more runs than ever before get new room from the arena, the old runs stay there until the surface's scope is released
+void surface_end(Surface *surface) {
+	vram = surfaceScreen.vram;
+	width = surfaceScreen.width;
+	height = surfaceScreen.height;
+	dirtyRectCount = surfaceScreen.dirtyRectCount;
+	memcpy(dirtyRects, surfaceScreen.dirtyRects, sizeof(dirtyRects));
+	dirtyPixelBox = surfaceScreen.dirtyPixelBox;
+	uint32_t count = 0;
+	for (uint16_t j = 0; j < surface->h; j++) {
+		count += texture_row_spans(surface->pixels + j*surface->stride, surface->w, 0);
+	}
+	if (count > surface->spanCapacity) {
+		surface->spans = (TextureSpan*)arena_alloc(&assetArena, count*sizeof(TextureSpan));
+		surface->spanCapacity = surface->spans ? count : 0;
+	}
+	uint32_t s = 0;
+	for (uint16_t j = 0; j < surface->h; j++) {
+		surface->rowSpans[j] = s;
+		if (s < surface->spanCapacity) s += texture_row_spans(surface->pixels + j*surface->stride, surface->w, surface->spans + s);
+	}
+	surface->rowSpans[surface->h] = s;
+	surface->texture.spans = surface->spans;
+}
+
+// a surface with the texture drawn into it, so it's blitted as plain rgb565 runs from then on
+Surface *surface_from_texture(Texture *tex) {
+	if (!tex) return 0;
+	Surface *surface = surface_create(tex->w, tex->h);
+	if (!surface) return 0;
+	surface_begin(surface);
+	DRAW_TEXTURE(tex, 0, 0);
+	surface_end(surface);
+	return surface;
+}
@@ -0,0 +1,175 @@
+// texture_format.hpp
+
+// Layout of the texture files written by convert_textures.py
+// rgb565:  uint16 w, uint16 h, then w*h rgb565 texels row after row
+// indexed: "TX", format (4 or 8 bits per texel), number of colours - 1, uint16 w, uint16 h, the rgb565 palette,
+//          then h rows of indices, every row starts on a whole byte and 4-bit rows have the left texel in the high nibble
+// rle:     "TX", 0x88, number of colours - 1, uint16 w, uint16 h, uint32 size of the packets, the palette, padding to 4 bytes,
+//          h uint32 row offsets into the packets (rows that encode the same share their packets), then the packets
+//          a packet byte c < 128 is followed by c+1 indices, c >= 128 by one index that repeats c-125 times
+// tiled:   "TX", 0x48, number of colours - 1, uint16 w, uint16 h, log2 of the tile size, number of single colour tiles,
+//          uint16 number of tiles, the palette, one byte per tile of the image (row after row of tiles) saying which tile goes there,
+//          then the tiles, each one is tile size rows of tile size 8-bit indices, the single colour tiles come first
+//          tiles on the right and bottom edge are padded with index 0
+// Index 0 is reserved for transparency, its palette entry is TRANSPARENCY_COLOR
+// The header is always read as big endian bytes, the palette, row offsets and rgb565 texels are swapped to the host order after loading
+
+#pragma once
+
+#include <stdint.h>
+
+enum TextureFormat : uint8_t {
+	TEXTURE_RGB565 = 0,
+	TEXTURE_INDEXED4 = 4,
+	TEXTURE_INDEXED8 = 8,
+	TEXTURE_RLE8 = 0x88,
+	TEXTURE_TILED8 = 0x48,
+};
+
+// bytes needed by texture_file_info
+#define TEXTURE_HEADER_PEEK 12
+
+struct TextureFileInfo {
+	uint8_t format;
+	uint16_t w;
+	uint16_t h;
+	uint16_t colors; // palette entries, 0 for rgb565
+	uint32_t paletteOffset;
+	uint32_t rowOffset; // where the row offsets of the rle format start, 0 for the others
+	uint32_t mapOffset; // where the tile map of the tiled format starts, 0 for the others
+	uint8_t tileShift; // tiles are 1 << tileShift texels wide and high
+	uint8_t solidTiles; // the first solidTiles tiles have a single colour
+	uint16_t tiles; // tiles after the map of the tiled format, 0 for the others
+	uint32_t texelOffset; // where the texel rows (or the rle packets) start in the file
+	uint32_t stride; // bytes per texel row (of a tile for the tiled format), 0 for rle
+	uint32_t size; // of the whole file
+};
+
+// reads the header from the first TEXTURE_HEADER_PEEK bytes of a file, false if it isn't a texture file
+inline bool texture_file_info(const uint8_t *file, TextureFileInfo *info) {
+	if (file[0] == 'T' && file[1] == 'X') {
+		info->format = file[2];
+		info->colors = file[3] + 1;
+		info->w = (file[4] << 8) | file[5];
+		info->h = (file[6] << 8) | file[7];
+		info->mapOffset = 0;
+		info->tileShift = 0;
+		info->solidTiles = 0;
+		info->tiles = 0;
+		if (info->format == TEXTURE_TILED8) {
+			uint32_t tileSize = 1u << file[8];
+			uint32_t tiles = (file[10] << 8) | file[11];
+			info->paletteOffset = 12;
+			info->rowOffset = 0;
+			info->mapOffset = 12 + info->colors*2;
+			info->tileShift = file[8];
+			info->solidTiles = file[9];
+			info->tiles = tiles;
+			info->texelOffset = info->mapOffset + ((info->w + tileSize - 1) >> file[8]) * ((info->h + tileSize - 1) >> file[8]);
+			info->stride = tileSize;
+			info->size = info->texelOffset + tiles * tileSize * tileSize;
+			return file[8] <= 7;
+		}
+		if (info->format == TEXTURE_RLE8) {
+			uint32_t packets = ((uint32_t)file[8] << 24) | ((uint32_t)file[9] << 16) | (file[10] << 8) | file[11];
+			info->paletteOffset = 12;
+			info->rowOffset = (12 + info->colors*2 + 3) & ~3u;
+			info->texelOffset = info->rowOffset + info->h*4;
+			info->stride = 0;
+			info->size = info->texelOffset + packets;
+			return true;
+		}
+		if (info->format != TEXTURE_INDEXED4 && info->format != TEXTURE_INDEXED8) return false;
+		info->paletteOffset = 8;
+		info->texelOffset = 8 + info->colors*2;
+		info->stride = info->format == TEXTURE_INDEXED4 ? (info->w + 1) / 2 : info->w;
+	} else {
+		info->format = TEXTURE_RGB565;
+		info->colors = 0;
+		info->w = (file[0] << 8) | file[1];
+		info->h = (file[2] << 8) | file[3];
+		info->paletteOffset = 0;
+		info->mapOffset = 0;
+		info->tileShift = 0;
+		info->solidTiles = 0;
+		info->tiles = 0;
+		info->texelOffset = 4;
+		info->stride = info->w * 2;
+	}
+	info->rowOffset = 0;
+	info->size = info->texelOffset + info->stride * info->h;
+	return true;
+}
+
+// checks what texture_file_info can't tell from the header, before anything reads the texels
+// the file has to be info->size bytes long (the caller knows how much it read) and in the host byte order already
+// every rle row has to start inside the packets and decode to exactly w texels without running past the end of the file,
+// every entry of a tile map has to be one of the tiles, and every palette index one of the colours
+// false when a blitter would read outside the file
+bool texture_file_check(const uint8_t *file, const TextureFileInfo *info) {
+	const uint8_t *texels = file + info->texelOffset;
+	if (info->format == TEXTURE_INDEXED8 || info->format == TEXTURE_INDEXED4) {
+		bool nibbles = info->format == TEXTURE_INDEXED4;
+		for (uint16_t j = 0; j < info->h; j++) {
+			const uint8_t *row = texels + j*info->stride;
+			for (uint16_t i = 0; i < info->w; i++) {
+				uint8_t index = nibbles ? (i & 1 ? row[i >> 1] & 15 : row[i >> 1] >> 4) : row[i];
+				if (index >= info->colors) return false;
+			}
+		}
+	}
+	if (info->format == TEXTURE_TILED8) {
+		if (info->solidTiles > info->tiles) return false;
+		for (const uint8_t *entry = file + info->mapOffset; entry < texels; entry++) {
+			if (*entry >= info->tiles) return false;
+		}
+		for (const uint8_t *texel = texels; texel < file + info->size; texel++) {
+			if (*texel >= info->colors) return false;
+		}
+	}
+	if (info->format == TEXTURE_RLE8) {
+		const uint8_t *packets = file + info->texelOffset;
+		const uint8_t *end = file + info->size;
+		const uint32_t *rowOffsets = (const uint32_t*)(file + info->rowOffset);
+		for (uint16_t j = 0; j < info->h; j++) {
+			if (rowOffsets[j] >= (uint32_t)(end - packets)) return false;
+			const uint8_t *packet = packets + rowOffsets[j];
+			uint32_t x = 0;
+			while (x < info->w) {
+				if (packet >= end) return false;
+				uint8_t c = *packet;
+				bool repeat = c >= 128;
+				uint32_t n = repeat ? c - 125 : c + 1;
+				uint32_t bytes = repeat ? 2 : n + 1;
+				if (bytes > (uint32_t)(end - packet) || x + n > info->w) return false;
+				for (uint32_t k = 1; k < (repeat ? 2 : bytes); k++) {
+					if (packet[k] >= info->colors) return false;
+				}
+				packet += bytes;
+				x += n;
+			}
+		}
+	}
+	return true;
+}
+
+// swaps the byte order of the values after the header (the palette, the rle row offsets or the rgb565 texels)
+inline void texture_file_swap(uint8_t *file) {
+	TextureFileInfo info;
+	if (!texture_file_info(file, &info)) return;
+	uint8_t *start = file + (info.format == TEXTURE_RGB565 ? info.texelOffset : info.paletteOffset);
+	uint8_t *end = start + (info.format == TEXTURE_RGB565 ? info.w*info.h*2 : info.colors*2);
+	for (uint8_t *b = start; b + 1 < end; b += 2) {
+		uint8_t t = b[0];
+		b[0] = b[1];
+		b[1] = t;
+	}
+	for (uint8_t *b = file + info.rowOffset; info.rowOffset && b < file + info.texelOffset; b += 4) {
+		uint8_t t = b[0];
+		b[0] = b[3];
+		b[3] = t;
+		t = b[1];
+		b[1] = b[2];
+		b[2] = t;
+	}
+}
@@ -0,0 +1,66 @@
+// triangle_functions.hpp
+
+// The rows of a filled triangle, without drawing them, so the same code fills vram in calc.cpp and is checked on the pc by tools/raster_check.cpp
+// Every pixel (x, y) is tested against the three edge functions E(x, y) = A*x + B*y + C, which are positive inside.
+// E is linear in x, so on each row the inside of every edge is a half-line that ends at x = -(B*y + C)/A.
+// The span of the row is the intersection of the three half-lines, clipped to the screen.
+// Pixels exactly on an edge belong to the triangle only if it is a top or a left edge (top-left fill rule),
+// so triangles that share an edge never cover the shared pixels twice and never leave a gap between them.
+
+#pragma once
+
+// the edge functions are products of two coordinates, within these limits they stay in 32 bits
+#define TRIANGLE_FAR 16383
+
+// division rounding towards -infinity / +infinity, d has to be positive
+static inline int floorDiv(int n, int d) { return n>=0 ? n/d : -((-n+d-1)/d); }
+static inline int ceilDiv(int n, int d) { return n>=0 ? (n+d-1)/d : -((-n)/d); }
+
+// calls span(y, left, right) for every row of the screen the triangle covers, left <= right and both on screen
+// nothing is covered when the triangle has no area or a vertex is TRIANGLE_FAR or further off the origin
+template <typename Span>
+void triangle_spans(int x0, int y0, int x1, int y1, int x2, int y2, int width, int height, Span span) {
+	const int far = TRIANGLE_FAR;
+	bool small = x0>-far && x0<far && y0>-far && y0<far && x1>-far && x1<far && y1>-far && y1<far && x2>-far && x2<far && y2>-far && y2<far;
+	if (!small) return;
+	int area = (x1-x0)*(y2-y0) - (y1-y0)*(x2-x0); // twice the signed area
+	if (area == 0) return;
+
+	// walking the vertices in this order keeps the inside positive for every edge
+	int ex[3] = {x0, area>0 ? x1 : x2, area>0 ? x2 : x1};
+	int ey[3] = {y0, area>0 ? y1 : y2, area>0 ? y2 : y1};
+	int A[3], B[3], C[3], bias[3];
+	for (int e=0; e<3; e++) {
+		int ax = ex[e], ay = ey[e];
+		int dx = ex[(e+1)%3]-ax, dy = ey[(e+1)%3]-ay;
+		// E(x, y) = dx*(y-ay) - dy*(x-ax)
+		A[e] = -dy;
+		B[e] = dx;
+		C[e] = dy*ax - dx*ay;
+		// left edges go up, top edges are horizontal and go right (the inside is below them)
+		bool topLeft = dy<0 || (dy==0 && dx>0);
+		bias[e] = topLeft ? 0 : 1; // E >= bias
+	}
+
+	int ymin = y0<y1 ? (y0<y2 ? y0 : y2) : (y1<y2 ? y1 : y2);
+	int ymax = y0>y1 ? (y0>y2 ? y0 : y2) : (y1>y2 ? y1 : y2);
+	if (ymin<0) ymin = 0;
+	if (ymax>height-1) ymax = height-1;
+
+	for (int y=ymin; y<=ymax; y++) {
+		int left = 0, right = width-1;
+		for (int e=0; e<3; e++) {
+			int rest = bias[e] - B[e]*y - C[e]; // the edge wants A*x >= rest
+			if (A[e]>0) {
+				int x = ceilDiv(rest, A[e]);
+				if (x>left) left = x;
+			} else if (A[e]<0) {
+				int x = floorDiv(-rest, -A[e]);
+				if (x<right) right = x;
+			} else if (rest>0) {
+				left = width; // a horizontal edge with the row on its outside
+			}
+		}
+		if (left<=right) span(y, left, right);
+	}
+}
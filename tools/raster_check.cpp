@@ -0,0 +1,174 @@
+// raster_check.cpp
+
+// Checks the rows triangle() fills (triangle_spans in triangle_functions.hpp) against a plain rasterizer on the host
+// the reference tests every pixel of the screen against the three edge functions in 64 bits, with the same top-left rule and no division,
+// so any pixel the spans get wrong (rounding of the divisions, clipping, the bias of an edge) shows up as a difference
+// it also fills pairs of triangles that share an edge and checks that no pixel is covered twice and none inside is left out
+// build and run with "make raster_check", then "dist/raster_check [triangles] [seed]", it returns 1 when a pixel differs
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include "triangle_functions.hpp"
+#include "lib/functions/random.hpp"
+
+const int maxWidth = 320;
+const int maxHeight = 528;
+
+uint8_t coverage[maxWidth * maxHeight];
+uint8_t reference[maxWidth * maxHeight];
+
+// twice the signed area of a, b, p in 64 bits, positive when p is on the inside of the edge a to b of a triangle with a positive area
+inline int64_t edge(int ax, int ay, int bx, int by, int px, int py) {
+	return (int64_t)(bx-ax)*(py-ay) - (int64_t)(by-ay)*(px-ax);
+}
+
+// the edge a to b of a triangle with a positive area, the inside is below a top edge and right of a left edge
+inline bool top_left(int ax, int ay, int bx, int by) {
+	return (ay == by && bx > ax) || by < ay;
+}
+
+inline bool inside(int ax, int ay, int bx, int by, int px, int py) {
+	int64_t e = edge(ax, ay, bx, by, px, py);
+	return e > 0 || (e == 0 && top_left(ax, ay, bx, by));
+}
+
+// adds the pixels the spans fill to coverage, counts the ones that were outside the screen or filled twice by one triangle
+uint32_t fill_spans(int x0, int y0, int x1, int y1, int x2, int y2, int width, int height, uint8_t *out) {
+	uint32_t wrong = 0;
+	int lastY = -1;
+	triangle_spans(x0, y0, x1, y1, x2, y2, width, height, [&](int y, int left, int right) {
+		if (y <= lastY || y < 0 || y >= height || left < 0 || right >= width || left > right) {
+			wrong++;
+			return;
+		}
+		lastY = y;
+		for (int x = left; x <= right; x++) out[y*width + x]++;
+	});
+	return wrong;
+}
+
+void fill_reference(int x0, int y0, int x1, int y1, int x2, int y2, int width, int height, uint8_t *out) {
+	const int far = TRIANGLE_FAR;
+	int v[6] = {x0, y0, x1, y1, x2, y2};
+	for (int k = 0; k < 6; k++) {
+		if (v[k] <= -far || v[k] >= far) return; // triangle() only draws the outline then
+	}
+	int64_t area = edge(x0, y0, x1, y1, x2, y2);
+	if (area == 0) return;
+	if (area < 0) {
+		int t = x1; x1 = x2; x2 = t;
+		t = y1; y1 = y2; y2 = t;
+	}
+	for (int y = 0; y < height; y++) {
+		for (int x = 0; x < width; x++) {
+			if (inside(x0, y0, x1, y1, x, y) && inside(x1, y1, x2, y2, x, y) && inside(x2, y2, x0, y0, x, y)) out[y*width + x]++;
+		}
+	}
+}
+
+// the pixels of one triangle that differ from the reference
+uint32_t check(int x0, int y0, int x1, int y1, int x2, int y2, int width, int height) {
+	memset(coverage, 0, width * height);
+	memset(reference, 0, width * height);
+	uint32_t wrong = fill_spans(x0, y0, x1, y1, x2, y2, width, height, coverage);
+	fill_reference(x0, y0, x1, y1, x2, y2, width, height, reference);
+	for (int k = 0; k < width * height; k++) wrong += coverage[k] != reference[k];
+	if (wrong) printf("(%d, %d) (%d, %d) (%d, %d) on %dx%d: %u pixels differ\n", x0, y0, x1, y1, x2, y2, width, height, wrong);
+	return wrong;
+}
+
+// a convex quad as two triangles along the diagonal from a to c, the pixels covered twice and the ones strictly inside it covered by neither
+uint32_t check_shared(const int *q, int width, int height) {
+	memset(coverage, 0, width * height);
+	uint32_t wrong = fill_spans(q[0], q[1], q[2], q[3], q[4], q[5], width, height, coverage);
+	wrong += fill_spans(q[0], q[1], q[4], q[5], q[6], q[7], width, height, coverage);
+	int64_t sign = edge(q[0], q[1], q[2], q[3], q[4], q[5]) > 0 ? 1 : -1;
+	for (int y = 0; y < height; y++) {
+		for (int x = 0; x < width; x++) {
+			bool strictlyInside = true;
+			for (int k = 0; k < 4; k++) {
+				int a = 2*k, b = 2*((k+1)%4);
+				strictlyInside = strictlyInside && sign * edge(q[a], q[a+1], q[b], q[b+1], x, y) > 0;
+			}
+			uint8_t c = coverage[y*width + x];
+			wrong += c > 1 || (strictlyInside && c == 0);
+		}
+	}
+	if (wrong) printf("quad (%d, %d) (%d, %d) (%d, %d) (%d, %d) on %dx%d: %u pixels covered twice or not at all\n", q[0], q[1], q[2], q[3], q[4], q[5], q[6], q[7], width, height, wrong);
+	return wrong;
+}
+
+bool convex(const int *q) {
+	int64_t first = 0;
+	for (int k = 0; k < 4; k++) {
+		int a = 2*k, b = 2*((k+1)%4), c = 2*((k+2)%4);
+		int64_t e = edge(q[a], q[a+1], q[b], q[b+1], q[c], q[c+1]);
+		if (e == 0 || (first && (e > 0) != (first > 0))) return false;
+		if (!first) first = e;
+	}
+	return true;
+}
+
+int main(int argc, char **argv) {
+	if (argc > 1 && (argv[1][0] < '0' || argv[1][0] > '9')) {
+		printf("usage: %s [triangles] [seed]\n", argv[0]);
+		return 1;
+	}
+	uint32_t triangles = argc > 1 ? strtoul(argv[1], 0, 10) : 20000;
+	RandomGenerator rng;
+	rng.SetSeed(argc > 2 ? strtoul(argv[2], 0, 10) : 1337);
+
+	uint32_t checked = 0, failed = 0;
+	auto run = [&](uint32_t wrong) {
+		checked++;
+		failed += wrong != 0;
+	};
+
+	// the cases of the fill rule: flat tops and bottoms, vertical edges, both windings, single pixels, slivers and edges on pixel centers
+	const int w = 16, h = 12;
+	const int cases[][6] = {
+		{2, 2, 10, 2, 6, 9}, {2, 2, 6, 9, 10, 2}, // flat top
+		{6, 1, 2, 8, 10, 8}, {6, 1, 10, 8, 2, 8}, // flat bottom
+		{3, 1, 3, 10, 12, 5}, {12, 1, 12, 10, 3, 5}, // vertical left and right edges
+		{0, 0, 1, 0, 0, 1}, {1, 1, 2, 1, 2, 2}, // a pixel or none
+		{0, 0, 15, 1, 0, 2}, {0, 0, 15, 11, 14, 11}, // slivers
+		{4, 4, 4, 4, 9, 9}, {1, 1, 5, 5, 9, 9}, // no area
+		{-5, -5, 20, -5, -5, 20}, {-40, 6, 60, 2, 8, 30}, // clipped
+		{-9, -9, -1, -9, -5, -1}, {20, 20, 30, 14, 25, 40}, // off the screen
+		{0, 0, 16, 0, 0, 12}, {16, 0, 16, 12, 0, 12}, // the screen split along its diagonal
+	};
+	for (const int *t : cases) run(check(t[0], t[1], t[2], t[3], t[4], t[5], w, h));
+	const int quads[][8] = {
+		{0, 0, 16, 0, 16, 12, 0, 12}, {0, 0, 0, 12, 16, 12, 16, 0},
+		{8, 0, 16, 6, 8, 12, 0, 6}, {2, 3, 13, 1, 11, 10, 1, 9},
+	};
+	for (const int *q : quads) run(check_shared(q, w, h));
+
+	// small random triangles around a small screen, most of their edges land on pixel centers somewhere
+	for (uint32_t k = 0; k < triangles; k++) {
+		int v[6];
+		for (int &c : v) c = (int)rng.Generate(48) - 8;
+		run(check(v[0], v[1], v[2], v[3], v[4], v[5], 32, 24));
+	}
+	for (uint32_t k = 0; k < triangles; k++) {
+		int q[8];
+		for (int &c : q) c = (int)rng.Generate(40) - 4;
+		if (convex(q)) run(check_shared(q, 32, 24));
+	}
+	// big ones on the calculator's screen, with vertices up to the limit where the edge functions still fit in 32 bits
+	for (uint32_t k = 0; k < triangles / 100; k++) {
+		int v[6];
+		for (int &c : v) c = (int)rng.Generate(2 * TRIANGLE_FAR - 1) - (TRIANGLE_FAR - 1);
+		run(check(v[0], v[1], v[2], v[3], v[4], v[5], maxWidth, maxHeight));
+		for (int &c : v) c = (int)rng.Generate(maxWidth + 200) - 100;
+		run(check(v[0], v[1], v[2], v[3], v[4], v[5], maxWidth, maxHeight));
+	}
+	// past the limit only the outline is drawn
+	run(check(-TRIANGLE_FAR, 0, 100, 0, 50, 100, maxWidth, maxHeight));
+	run(check(0, 0, TRIANGLE_FAR, 50, 0, 100, maxWidth, maxHeight));
+
+	printf("%u triangles and quads checked, %u wrong\n", checked, failed);
+	return failed ? 1 : 0;
+}
@@ -0,0 +1,188 @@
+// simulate.cpp
+
+// Plays the game headless on the host with a simple bot, to see how fast the simulation steps and how far the bot gets
+// the bot jumps whenever the bird is below the middle of the gap of the next pipe and not already going up
+// build and run with "make simulate", then "dist/simulate [games] [first seed]"
+// "dist/simulate record <file> [seed]" saves a replay of one game of the bot,
+// "dist/simulate play <file> [times]" fast-forwards a replay (last.rpl from the calculator for example) and tells if it still plays the same,
+// the same replay is the same work on every build, so its frames/s compare builds
+// "dist/simulate rng" checks the period and the distribution of RandomGenerator and how many numbers it makes per second
+// any other arguments print these uses and exit with 1
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include "lib/core/simulation.hpp"
+#include "lib/core/replay.hpp"
+
+// the screen of the calculator
+const int16_t screenWidth = 320;
+const int16_t screenHeight = 528;
+
+// frames a game can last before the bot is stopped (1000 pipes), it can get lucky forever
+const uint32_t maxFrames = 1000 * pipeSpawnFrames;
+
+uint8_t bot(const GameState *game) {
+	int16_t target = game->height / 2;
+	const PipePool *pool = &game->pipes;
+	for (uint32_t s = pool->head; s != pool->tail; s++) {
+		uint8_t k = pipe_slot(s);
+		if (pool->x[k] + pipeWidth > game->birdX) {
+			target = (pool->topY[k] + pool->bottomY[k]) / 2;
+			break;
+		}
+	}
+	return game->birdY + birdHeight / 2 > target && game->velocity >= 0 ? INPUT_JUMP : 0;
+}
+
+double seconds_since(std::chrono::steady_clock::time_point start) {
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+uint8_t replayBuffer[1 << 24];
+
+int record(const char *path, uint32_t seed) {
+	GameState game;
+	sim_init(&game, seed, screenWidth, screenHeight);
+	replay_init(&gameReplay, replayBuffer, sizeof(replayBuffer));
+	replay_record_begin(&gameReplay, &game);
+	while (!game.over && game.frame < maxFrames) {
+		uint8_t input = bot(&game);
+		sim_step(&game, input);
+		replay_record(&gameReplay, input, &game);
+	}
+	if (!replay_save(&gameReplay, path)) {
+		printf("can't write %s\n", path);
+		return 1;
+	}
+	printf("%s: seed %u, %u frames, score %u, %u bytes of input\n", path, gameReplay.seed, gameReplay.frames, game.score, gameReplay.eventBytes);
+	return 0;
+}
+
+int play(const char *path, uint32_t times) {
+	replay_init(&gameReplay, replayBuffer, sizeof(replayBuffer));
+	if (!replay_load(&gameReplay, path)) {
+		printf("%s isn't a replay this build can read\n", path);
+		return 1;
+	}
+	GameState game;
+	uint32_t diverged = 0;
+	auto start = std::chrono::steady_clock::now();
+	for (uint32_t k = 0; k < times; k++) diverged = replay_fast_forward(&gameReplay, &game);
+	double seconds = seconds_since(start);
+	double frames = (double)gameReplay.frames * times;
+	printf("%s: seed %u, %u frames, score %u, played %u times in %.3f s, %.0f frames/s\n", path, gameReplay.seed, gameReplay.frames, game.score, times, seconds, frames / (seconds > 0 ? seconds : 1));
+	if (diverged) {
+		printf("diverged from the recording at frame %u\n", diverged);
+		return 2;
+	}
+	printf("played the same as it was recorded\n");
+	return 0;
+}
+
+// chi-square of draws numbers from 0 to max-1 against a flat distribution, about max-1 (within a few times sqrt(2*(max-1))) when it's flat
+double chi_square(uint32_t seed, uint16_t max, uint32_t draws) {
+	static uint32_t counts[65536];
+	memset(counts, 0, max * sizeof(uint32_t));
+	RandomGenerator rng;
+	rng.SetSeed(seed);
+	for (uint32_t k = 0; k < draws; k++) counts[rng.Generate(max)]++;
+	double expected = (double)draws / max;
+	double chi = 0;
+	for (uint32_t v = 0; v < max; v++) chi += (counts[v] - expected) * (counts[v] - expected) / expected;
+	return chi;
+}
+
+int rng() {
+	// the period of the state, every state but 0 comes once
+	auto start = std::chrono::steady_clock::now();
+	uint32_t x = 1;
+	uint64_t period = 0;
+	do {
+		x = random_step(x);
+		period++;
+	} while (x != 1);
+	printf("period %llu (2^32-1 is %llu), %.3f s\n", (unsigned long long)period, (unsigned long long)0xFFFFFFFF, seconds_since(start));
+
+	const uint32_t draws = 10000000;
+	const uint16_t ranges[] = {2, 100, 200, 1000, 43691};
+	for (uint16_t max : ranges) {
+		printf("range %5u: chi-square %9.1f for %u degrees of freedom\n", max, chi_square(1337, max, draws), max - 1);
+	}
+
+	// Fill has to give what Generate gives
+	RandomGenerator a, b;
+	a.SetSeed(42);
+	b.SetSeed(42);
+	static uint16_t buffer[4096];
+	a.Fill(buffer, 4096, 200);
+	bool same = true;
+	for (uint32_t k = 0; k < 4096; k++) same = same && b.Generate(200) == buffer[k];
+	printf("Fill %s Generate\n", same && a.m_state == b.m_state ? "matches" : "DOESN'T match");
+
+	// numbers per second, the sums keep the compiler from dropping the loops
+	const uint32_t count = 100000000;
+	uint32_t sum = 0;
+	start = std::chrono::steady_clock::now();
+	for (uint32_t k = 0; k < count; k++) sum += a.Next();
+	printf("Next:          %6.1f M/s\n", count / seconds_since(start) / 1e6);
+	start = std::chrono::steady_clock::now();
+	for (uint32_t k = 0; k < count; k++) sum += a.Generate(200);
+	printf("Generate(200): %6.1f M/s\n", count / seconds_since(start) / 1e6);
+	start = std::chrono::steady_clock::now();
+	for (uint32_t k = 0; k < count; k += 4096) {
+		a.Fill(buffer, 4096, 200);
+		sum += buffer[4095];
+	}
+	printf("Fill(200):     %6.1f M/s (%u)\n", count / seconds_since(start) / 1e6, sum & 1);
+	return 0;
+}
+
+int usage(const char *name) {
+	printf("usage: %s [games] [first seed]\n", name);
+	printf("       %s record <file> [seed]\n", name);
+	printf("       %s play <file> [times]\n", name);
+	printf("       %s rng\n", name);
+	return 1;
+}
+
+// true when every argument from first on is a number
+bool numbers(int argc, char **argv, int first) {
+	for (int k = first; k < argc; k++) {
+		char *end;
+		strtoul(argv[k], &end, 10);
+		if (!argv[k][0] || *end) return false;
+	}
+	return true;
+}
+
+int main(int argc, char **argv) {
+	if (argc == 2 && strcmp(argv[1], "rng") == 0) return rng();
+	if (argc > 2 && argc < 5 && strcmp(argv[1], "record") == 0 && numbers(argc, argv, 3)) return record(argv[2], argc > 3 ? strtoul(argv[3], 0, 10) : 1337);
+	if (argc > 2 && argc < 5 && strcmp(argv[1], "play") == 0 && numbers(argc, argv, 3)) return play(argv[2], argc > 3 ? strtoul(argv[3], 0, 10) : 1);
+	if (argc > 3 || !numbers(argc, argv, 1)) return usage(argv[0]);
+
+	uint32_t games = argc > 1 ? strtoul(argv[1], 0, 10) : 1000;
+	uint32_t seed = argc > 2 ? strtoul(argv[2], 0, 10) : 1337;
+
+	uint64_t frames = 0;
+	uint64_t scores = 0;
+	uint16_t best = 0;
+	auto start = std::chrono::steady_clock::now();
+	for (uint32_t g = 0; g < games; g++) {
+		GameState game;
+		sim_init(&game, seed + g, screenWidth, screenHeight);
+		while (!game.over && game.frame < maxFrames) {
+			sim_step(&game, bot(&game));
+		}
+		frames += game.frame;
+		scores += game.score;
+		if (game.score > best) best = game.score;
+	}
+	double seconds = seconds_since(start);
+
+	printf("%u games from seed %u: %llu frames in %.3f s, %.0f frames/s\n", games, seed, (unsigned long long)frames, seconds, frames / (seconds > 0 ? seconds : 1));
+	printf("score: %.2f on average, %u at best\n", games ? (double)scores / games : 0.0, best);
+	return 0;
+}